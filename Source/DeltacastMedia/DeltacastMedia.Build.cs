@@ -60,6 +60,7 @@ public class DeltacastMedia : ModuleRules
             // ... add private dependencies that you statically link with here ...
             "CoreUObject",
             "Engine",
+            "Projects",
             "Slate",
             "SlateCore",
          }
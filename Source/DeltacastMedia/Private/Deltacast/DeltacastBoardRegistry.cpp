@@ -0,0 +1,240 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastBoardRegistry.h"
+
+#include "DeltacastHelpers.h"
+#include "DeltacastSdk.h"
+#include "IDeltacastMediaModule.h"
+#include "Misc/ScopeLock.h"
+
+#include <algorithm>
+
+
+
+FDeltacastBoard::FDeltacastBoard(const VHDHandle InBoardHandle, FDeltacastBoardInfo InInfo)
+	: BoardHandle(InBoardHandle),
+	  Info(MoveTemp(InInfo))
+{
+	check(BoardHandle != VHD::InvalidHandle);
+}
+
+FDeltacastBoard::~FDeltacastBoard()
+{
+	UE_LOG(LogDeltacastMedia, Verbose, TEXT("Closing board %u"), Info.BoardIndex);
+
+	[[maybe_unused]] const auto Result = FDeltacast::GetSdk().CloseBoardHandle(BoardHandle);
+}
+
+
+std::optional<VHD_CHANNELTYPE> FDeltacastBoard::GetChannelType(const bool bIsInput, const VHD::ULONG PortIndex) const
+{
+	if (PortIndex >= VHD::MaxPortCount)
+	{
+		return {};
+	}
+
+	const auto ChannelType = bIsInput ? Info.RxChannelTypes[PortIndex] : Info.TxChannelTypes[PortIndex];
+	if (ChannelType == VHD_CHANNELTYPE::NB_VHD_CHANNELTYPE)
+	{
+		return {};
+	}
+
+	return ChannelType;
+}
+
+VHD::ULONG FDeltacastBoard::GetSdiPortCount(const bool bIsInput) const
+{
+	const auto& ChannelTypes = bIsInput ? Info.RxChannelTypes : Info.TxChannelTypes;
+
+	return static_cast<VHD::ULONG>(std::count_if(ChannelTypes.cbegin(), ChannelTypes.cend(), [](const VHD_CHANNELTYPE ChannelType)
+	{
+		return ChannelType != VHD_CHANNELTYPE::NB_VHD_CHANNELTYPE && Deltacast::Helpers::IsSdi(ChannelType);
+	}));
+}
+
+VHD::ULONG FDeltacastBoard::GetDvPortCount(const bool bIsInput) const
+{
+	const auto& ChannelTypes = bIsInput ? Info.RxChannelTypes : Info.TxChannelTypes;
+
+	return static_cast<VHD::ULONG>(std::count_if(ChannelTypes.cbegin(), ChannelTypes.cend(), [](const VHD_CHANNELTYPE ChannelType)
+	{
+		return ChannelType != VHD_CHANNELTYPE::NB_VHD_CHANNELTYPE && Deltacast::Helpers::IsDv(ChannelType);
+	}));
+}
+
+bool FDeltacastBoard::IsSdiInterfaceSupported(const VHD_STREAMTYPE StreamType, const VHD_INTERFACE Interface) const
+{
+	const auto Key = (uint64{ static_cast<uint32>(StreamType) } << 32) | static_cast<uint32>(Interface);
+
+	FScopeLock Lock(&CapabilityCriticalSection);
+
+	if (const auto IsCapable = Capabilities.SdiInterfaces.Find(Key))
+	{
+		return *IsCapable;
+	}
+
+	const auto IsCapable = FDeltacast::GetSdk().GetBoardCapSdiInterface(BoardHandle, StreamType, Interface).value_or(false);
+	Capabilities.SdiInterfaces.Add(Key, IsCapable);
+
+	return IsCapable;
+}
+
+bool FDeltacastBoard::IsSdiVideoStandardSupported(const VHD_STREAMTYPE StreamType, const VHD_VIDEOSTANDARD VideoStandard) const
+{
+	const auto Key = (uint64{ static_cast<uint32>(StreamType) } << 32) | static_cast<uint32>(VideoStandard);
+
+	FScopeLock Lock(&CapabilityCriticalSection);
+
+	if (const auto IsCapable = Capabilities.SdiVideoStandards.Find(Key))
+	{
+		return *IsCapable;
+	}
+
+	const auto IsCapable = FDeltacast::GetSdk().GetBoardCapSdiVideoStandard(BoardHandle, StreamType, VideoStandard).value_or(false);
+	Capabilities.SdiVideoStandards.Add(Key, IsCapable);
+
+	return IsCapable;
+}
+
+FDeltacastBoardCapabilities FDeltacastBoard::GetCapabilities() const
+{
+	FScopeLock Lock(&CapabilityCriticalSection);
+
+	return Capabilities;
+}
+
+void FDeltacastBoard::MergeCapabilities(const FDeltacastBoardCapabilities& KnownCapabilities) const
+{
+	FScopeLock Lock(&CapabilityCriticalSection);
+
+	for (const auto& [Key, IsCapable] : KnownCapabilities.SdiInterfaces)
+	{
+		Capabilities.SdiInterfaces.FindOrAdd(Key, IsCapable);
+	}
+
+	for (const auto& [Key, IsCapable] : KnownCapabilities.SdiVideoStandards)
+	{
+		Capabilities.SdiVideoStandards.FindOrAdd(Key, IsCapable);
+	}
+}
+
+
+
+FDeltacastBoardRef FDeltacastBoardRegistry::Acquire(const VHD::ULONG BoardIndex)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (const auto ExistingBoard = Boards.Find(BoardIndex))
+	{
+		return *ExistingBoard;
+	}
+
+	auto Board = OpenBoard(BoardIndex);
+	if (Board.IsValid())
+	{
+		Boards.Add(BoardIndex, Board);
+	}
+
+	return Board;
+}
+
+std::optional<FDeltacastBoardInfo> FDeltacastBoardRegistry::GetBoardInfo(const VHD::ULONG BoardIndex)
+{
+	const auto Board = Acquire(BoardIndex);
+	if (!Board.IsValid())
+	{
+		return {};
+	}
+
+	return Board->GetInfo();
+}
+
+void FDeltacastBoardRegistry::SynchronizeBoardCount(const VHD::ULONG BoardCount)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (KnownBoardCount.has_value() && KnownBoardCount.value() != BoardCount)
+	{
+		UE_LOG(LogDeltacastMedia, Display, TEXT("Board count changed from %u to %u, reopening the boards on next use"),
+		       KnownBoardCount.value(), BoardCount);
+		Boards.Reset();
+	}
+
+	KnownBoardCount = BoardCount;
+}
+
+void FDeltacastBoardRegistry::Reset()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	Boards.Reset();
+	KnownBoardCount.reset();
+}
+
+
+FDeltacastBoardRef FDeltacastBoardRegistry::OpenBoard(const VHD::ULONG BoardIndex)
+{
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
+	if (BoardHandle == VHD::InvalidHandle)
+	{
+		return nullptr;
+	}
+
+	FDeltacastBoardInfo Info;
+	Info.BoardIndex = BoardIndex;
+
+	VHD::ULONG SerialLower = 0;
+	VHD::ULONG SerialUpper = 0;
+
+	const auto SerialLowerResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_CORE_BOARDPROPERTY::VHD_CORE_BP_SERIALNUMBER_LSW, &SerialLower);
+	const auto SerialUpperResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_CORE_BOARDPROPERTY::VHD_CORE_BP_SERIALNUMBER_MSW, &SerialUpper);
+
+	if (!Deltacast::Helpers::IsValid(SerialLowerResult) ||
+	    !Deltacast::Helpers::IsValid(SerialUpperResult))
+	{
+		UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to get serial number of board %u: %s/%s"), BoardIndex,
+		       *Deltacast::Helpers::GetErrorString(SerialLowerResult), *Deltacast::Helpers::GetErrorString(SerialUpperResult));
+		[[maybe_unused]] const auto CloseResult = DeltacastSdk.CloseBoardHandle(BoardHandle);
+		return nullptr;
+	}
+
+	Info.SerialNumber = SerialLower + (uint64{ SerialUpper } << 32);
+
+	const auto BoardModel = DeltacastSdk.GetBoardModel(BoardIndex);
+	Info.Model            = BoardModel != nullptr ? FString(BoardModel) : FString();
+
+	Info.RxCount = DeltacastSdk.GetRxCount(BoardHandle).value_or(0);
+	Info.TxCount = DeltacastSdk.GetTxCount(BoardHandle).value_or(0);
+
+	Info.bIsFlexModule            = DeltacastSdk.IsFlexModule(BoardHandle).value_or(false);
+	Info.bIsFieldMergingSupported = DeltacastSdk.IsFieldMergingSupported(BoardHandle).value_or(false);
+	Info.bIsYuvk8Supported        = DeltacastSdk.GetBoardCapBufferPacking(BoardHandle, VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUVK4224_8).value_or(false);
+	Info.bIsRgb10Supported        = DeltacastSdk.GetBoardCapBufferPacking(BoardHandle, VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30).value_or(false);
+	Info.bIsRgba10Supported       = DeltacastSdk.GetBoardCapBufferPacking(BoardHandle, VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64).value_or(false);
+
+	for (VHD::ULONG PortIndex = 0; PortIndex < VHD::MaxPortCount; ++PortIndex)
+	{
+		Info.RxChannelTypes[PortIndex] = DeltacastSdk.GetChannelType(BoardHandle, true, PortIndex).value_or(VHD_CHANNELTYPE::NB_VHD_CHANNELTYPE);
+		Info.TxChannelTypes[PortIndex] = DeltacastSdk.GetChannelType(BoardHandle, false, PortIndex).value_or(VHD_CHANNELTYPE::NB_VHD_CHANNELTYPE);
+	}
+
+	UE_LOG(LogDeltacastMedia, Log, TEXT("Opened board %u: %s (serial %llx, %u RX, %u TX)"),
+	       BoardIndex, *Info.Model, Info.SerialNumber, Info.RxCount, Info.TxCount);
+
+	return MakeShared<FDeltacastBoard, ESPMode::ThreadSafe>(BoardHandle, MoveTemp(Info));
+}
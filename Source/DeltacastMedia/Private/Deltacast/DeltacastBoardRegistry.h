@@ -0,0 +1,140 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "DeltacastDefinition.h"
+
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+#include <array>
+#include <optional>
+
+
+
+/**
+ * Board properties that do not change while the board handle is open, read once when the board is opened
+ */
+struct DELTACASTMEDIA_API FDeltacastBoardInfo
+{
+	VHD::ULONG BoardIndex = 0;
+
+	uint64  SerialNumber = 0;
+	FString Model;
+
+	VHD::ULONG RxCount = 0;
+	VHD::ULONG TxCount = 0;
+
+	bool bIsFlexModule            = false;
+	bool bIsFieldMergingSupported = false;
+	bool bIsYuvk8Supported        = false;
+	bool bIsRgb10Supported        = false;
+	bool bIsRgba10Supported       = false;
+
+	/** `NB_VHD_CHANNELTYPE` when the channel type could not be read */
+	std::array<VHD_CHANNELTYPE, VHD::MaxPortCount> RxChannelTypes;
+	std::array<VHD_CHANNELTYPE, VHD::MaxPortCount> TxChannelTypes;
+};
+
+
+/**
+ * Memoized capability queries, keyed by stream type in the upper 32 bits and interface or video standard in the lower 32 bits
+ */
+struct DELTACASTMEDIA_API FDeltacastBoardCapabilities
+{
+	TMap<uint64, bool> SdiInterfaces;
+	TMap<uint64, bool> SdiVideoStandards;
+};
+
+
+/**
+ * Open SDK board handle shared by all the users of a board, the handle is closed when the last reference is released
+ */
+class DELTACASTMEDIA_API FDeltacastBoard final
+{
+public:
+	FDeltacastBoard(VHDHandle InBoardHandle, FDeltacastBoardInfo InInfo);
+	~FDeltacastBoard();
+
+	FDeltacastBoard(const FDeltacastBoard &Other)     = delete;
+	FDeltacastBoard(FDeltacastBoard &&Other) noexcept = delete;
+
+	FDeltacastBoard &operator=(const FDeltacastBoard &Other)     = delete;
+	FDeltacastBoard &operator=(FDeltacastBoard &&Other) noexcept = delete;
+
+public:
+	[[nodiscard]] VHDHandle GetHandle() const { return BoardHandle; }
+
+	[[nodiscard]] const FDeltacastBoardInfo &GetInfo() const { return Info; }
+
+public: // Capabilities, each distinct query reaches the SDK once per board
+	[[nodiscard]] std::optional<VHD_CHANNELTYPE> GetChannelType(bool bIsInput, VHD::ULONG PortIndex) const;
+
+	[[nodiscard]] VHD::ULONG GetSdiPortCount(bool bIsInput) const;
+	[[nodiscard]] VHD::ULONG GetDvPortCount(bool bIsInput) const;
+
+	[[nodiscard]] bool IsSdiInterfaceSupported(VHD_STREAMTYPE StreamType, VHD_INTERFACE Interface) const;
+	[[nodiscard]] bool IsSdiVideoStandardSupported(VHD_STREAMTYPE StreamType, VHD_VIDEOSTANDARD VideoStandard) const;
+
+	/** Copy of the capabilities queried so far */
+	[[nodiscard]] FDeltacastBoardCapabilities GetCapabilities() const;
+
+	/** Adds capabilities known from a previous session, entries already queried are kept */
+	void MergeCapabilities(const FDeltacastBoardCapabilities& KnownCapabilities) const;
+
+private:
+	const VHDHandle           BoardHandle;
+	const FDeltacastBoardInfo Info;
+
+	mutable FCriticalSection CapabilityCriticalSection;
+
+	mutable FDeltacastBoardCapabilities Capabilities;
+};
+
+using FDeltacastBoardRef = TSharedPtr<FDeltacastBoard, ESPMode::ThreadSafe>;
+
+
+/**
+ * Opens each board once for the session and hands out shared references to it.
+ * Board level settings (channel mode, loopback, clock system, ...) remain the responsibility of each user.
+ */
+class DELTACASTMEDIA_API FDeltacastBoardRegistry final
+{
+public:
+	/** Returns the open board, opening it on first use, nullptr on failure */
+	[[nodiscard]] FDeltacastBoardRef Acquire(VHD::ULONG BoardIndex);
+
+	/** Board properties, opening the board on first use */
+	[[nodiscard]] std::optional<FDeltacastBoardInfo> GetBoardInfo(VHD::ULONG BoardIndex);
+
+	/** Reset the registry when the number of boards changed, as the board indices may then refer to other boards */
+	void SynchronizeBoardCount(VHD::ULONG BoardCount);
+
+	/** Drops the registry references, boards still in use are closed when their last user releases them */
+	void Reset();
+
+private:
+	[[nodiscard]] static FDeltacastBoardRef OpenBoard(VHD::ULONG BoardIndex);
+
+private:
+	FCriticalSection CriticalSection;
+
+	TMap<VHD::ULONG, FDeltacastBoardRef> Boards;
+
+	std::optional<VHD::ULONG> KnownBoardCount;
+};
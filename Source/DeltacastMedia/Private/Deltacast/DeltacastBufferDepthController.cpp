@@ -0,0 +1,108 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastBufferDepthController.h"
+
+#include "Math/UnrealMathUtility.h"
+
+
+
+FDeltacastBufferDepthController::FDeltacastBufferDepthController(const FConfig& InConfig)
+	: Config(InConfig)
+{
+	check(Config.MinimumDepth <= Config.MaximumDepth);
+
+	Depth = Config.MinimumDepth;
+}
+
+
+std::optional<FDeltacastBufferDepthController::FAdjustment> FDeltacastBufferDepthController::Update(const uint32 DroppedFrameCount, const uint32 FilledSlotCount, const double Time)
+{
+	if (RemainingSettleFrames > 0)
+	{
+		--RemainingSettleFrames;
+		LastDroppedFrameCount = DroppedFrameCount;
+		return {};
+	}
+
+	if (!bIsWindowStarted)
+	{
+		RestartWindow(Time);
+		LastDroppedFrameCount = DroppedFrameCount;
+	}
+
+	const auto NewDroppedFrameCount = DroppedFrameCount > LastDroppedFrameCount ? DroppedFrameCount - LastDroppedFrameCount : 0;
+	LastDroppedFrameCount = DroppedFrameCount;
+
+	// Slots the queue did not need: free slots of an input queue, queued slots of an output queue
+	const auto FilledSlots = FMath::Min(FilledSlotCount, Depth);
+	const auto Headroom    = Config.bIsInput ? Depth - FilledSlots : FilledSlots;
+
+	ExhaustedFrameCount = Headroom == 0 ? ExhaustedFrameCount + 1 : 0;
+	MinimumHeadroom     = FMath::Min(MinimumHeadroom, Headroom);
+
+	if (NewDroppedFrameCount > 0 || ExhaustedFrameCount >= Config.SettleFrameCount)
+	{
+		RestartWindow(Time);
+
+		if (Depth < Config.MaximumDepth)
+		{
+			const auto Reason = NewDroppedFrameCount > 0
+				                    ? (Config.bIsInput ? TEXT("frames dropped") : TEXT("frames repeated"))
+				                    : (Config.bIsInput ? TEXT("no free slot") : TEXT("queue empty"));
+			return SetDepth(Depth + 1, Reason);
+		}
+
+		return {};
+	}
+
+	if (Time - WindowStartTime >= Config.StableSeconds)
+	{
+		const auto bCanShrink = MinimumHeadroom >= 2 && Depth > Config.MinimumDepth;
+
+		RestartWindow(Time);
+
+		if (bCanShrink)
+		{
+			return SetDepth(Depth - 1, TEXT("stable with unused slots"));
+		}
+	}
+
+	return {};
+}
+
+
+FDeltacastBufferDepthController::FAdjustment FDeltacastBufferDepthController::SetDepth(const uint32 NewDepth, const TCHAR* Reason)
+{
+	const FAdjustment Adjustment{ Depth, NewDepth, Reason };
+
+	Depth = NewDepth;
+	++AdjustmentCount;
+
+	// The stream restarts, its counters with it
+	RemainingSettleFrames = Config.SettleFrameCount;
+	LastDroppedFrameCount = 0;
+	ExhaustedFrameCount   = 0;
+	bIsWindowStarted      = false;
+
+	return Adjustment;
+}
+
+void FDeltacastBufferDepthController::RestartWindow(const double Time)
+{
+	WindowStartTime  = Time;
+	MinimumHeadroom  = Depth;
+	bIsWindowStarted = true;
+}
@@ -0,0 +1,93 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreTypes.h"
+
+#include <optional>
+
+
+
+/**
+ * Chooses the SDK buffer queue depth of a stream from its drop count and queue filling, within bounds.
+ * Starts at the minimum depth, grows by one slot when frames are dropped or the queue has no free slot left,
+ * and shrinks by one slot when the stream kept at least two unused slots without drops for a while.
+ * The stream applies a new depth by restarting, the controller only decides.
+ */
+class DELTACASTMEDIA_API FDeltacastBufferDepthController final
+{
+public:
+	struct FConfig
+	{
+		uint32 MinimumDepth = 2;
+		uint32 MaximumDepth = 8;
+
+		/** Input queues hold the captured slots waiting for the engine, output queues the engine slots waiting for the board */
+		bool bIsInput = true;
+
+		/** Time without drops and with unused slots before the depth is reduced */
+		double StableSeconds = 30.0;
+
+		/** Frames ignored after a change while the stream restarts, and frames with a full input or empty output queue before growing */
+		uint32 SettleFrameCount = 8;
+	};
+
+	struct FAdjustment
+	{
+		uint32 PreviousDepth;
+		uint32 Depth;
+
+		const TCHAR* Reason;
+	};
+
+public:
+	explicit FDeltacastBufferDepthController(const FConfig& InConfig);
+
+	[[nodiscard]] uint32 GetDepth() const { return Depth; }
+
+	[[nodiscard]] const FConfig& GetConfig() const { return Config; }
+
+	/** Number of depth changes since the controller was created */
+	[[nodiscard]] uint32 GetAdjustmentCount() const { return AdjustmentCount; }
+
+	/**
+	 * To be called once per frame with the drop count accumulated by the stream and the current queue filling in slots.
+	 * Returns the new depth when it must change, the stream counters are then expected to restart from zero.
+	 */
+	[[nodiscard]] std::optional<FAdjustment> Update(uint32 DroppedFrameCount, uint32 FilledSlotCount, double Time);
+
+private:
+	[[nodiscard]] FAdjustment SetDepth(uint32 NewDepth, const TCHAR* Reason);
+
+	void RestartWindow(double Time);
+
+private:
+	const FConfig Config;
+
+	uint32 Depth = 2;
+	uint32 AdjustmentCount = 0;
+
+	uint32 LastDroppedFrameCount = 0;
+	uint32 RemainingSettleFrames = 0;
+
+	/** Consecutive frames without a free input slot or with an empty output queue */
+	uint32 ExhaustedFrameCount = 0;
+
+	/** Lowest number of slots the stream could have done without since the window started */
+	uint32 MinimumHeadroom = 0;
+	double WindowStartTime = 0.0;
+	bool   bIsWindowStarted = false;
+};
@@ -455,6 +455,8 @@ enum class VHD_DV_CS : uint32
 	VHD_DV_CS_RGB_FULL = 0, /*! RGB full color space */
 	VHD_DV_CS_YUV601 = 2,   /*! YUV 601 (SD) color space */
 	VHD_DV_CS_YUV709 = 3,   /*! YUV 709 (HD) color space */
+	VHD_DV_CS_BT2020_RGB_FULL = 13, /*! BT.2020 RGB full color space */
+	VHD_DV_CS_BT2020_YCBCR = 14,    /*! BT.2020 YCbCr color space */
 	NB_VHD_DV_CS = 17
 };
 
@@ -462,6 +464,7 @@ enum class VHD_DV_SAMPLING : uint32
 {
 	VHD_DV_SAMPLING_4_2_2_12BITS = 6, /*! 4-2-2 12-bit sampling */
 	VHD_DV_SAMPLING_4_4_4_8BITS = 9,  /*! 4-4-4  8-bit sampling */
+	VHD_DV_SAMPLING_4_4_4_10BITS = 10, /*! 4-4-4 10-bit sampling */
 	NB_VHD_DV_SAMPLING = 13,
 };
 
@@ -495,6 +498,8 @@ enum class VHD_BUFFERPACKING : uint32
 	VHD_BUFPACK_VIDEO_YUV422_10 = 2,
 	VHD_BUFPACK_VIDEO_YUVK4224_10 = 3,
 	VHD_BUFPACK_VIDEO_RGB_32 = 8,
+	VHD_BUFPACK_VIDEO_RGB_30 = 12,  /*! 4:4:4 10-bit RGB in 32-bit words, R in the least significant bits, 2 unused bits */
+	VHD_BUFPACK_VIDEO_RGBA_64 = 13, /*! 4:4:4:4 10-bit RGBA in 16-bit R, G, B, A components, samples in the most significant bits */
 };
 
 #pragma endregion
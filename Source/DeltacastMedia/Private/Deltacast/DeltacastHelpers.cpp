@@ -26,18 +26,39 @@
 
 namespace Deltacast::Helpers
 {
-	FCablePacking::FCablePacking(const VHD_BUFFERPACKING BufferPacking, const bool IsSd)
+	FCablePacking::FCablePacking(const VHD_BUFFERPACKING BufferPacking, const bool IsSd, const EDeltacastColorimetry Colorimetry)
 	{
 		switch (BufferPacking)
 		{
 		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8: [[fallthrough]];
 		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_10:
 			Sampling = VHD_DV_SAMPLING::VHD_DV_SAMPLING_4_2_2_12BITS;
-			ColorSpace = IsSd ? VHD_DV_CS::VHD_DV_CS_YUV601 : VHD_DV_CS::VHD_DV_CS_YUV709;
+			switch (Colorimetry)
+			{
+			case EDeltacastColorimetry::Rec601:
+				ColorSpace = VHD_DV_CS::VHD_DV_CS_YUV601;
+				break;
+			case EDeltacastColorimetry::Rec709:
+				ColorSpace = VHD_DV_CS::VHD_DV_CS_YUV709;
+				break;
+			case EDeltacastColorimetry::Rec2020:
+				ColorSpace = VHD_DV_CS::VHD_DV_CS_BT2020_YCBCR;
+				break;
+			case EDeltacastColorimetry::Auto: [[fallthrough]];
+			default:
+				ColorSpace = IsSd ? VHD_DV_CS::VHD_DV_CS_YUV601 : VHD_DV_CS::VHD_DV_CS_YUV709;
+				break;
+			}
 			break;
 		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_32:
 			Sampling = VHD_DV_SAMPLING::VHD_DV_SAMPLING_4_4_4_8BITS;
-			ColorSpace = VHD_DV_CS::VHD_DV_CS_RGB_FULL;
+			ColorSpace = Colorimetry == EDeltacastColorimetry::Rec2020 ? VHD_DV_CS::VHD_DV_CS_BT2020_RGB_FULL : VHD_DV_CS::VHD_DV_CS_RGB_FULL;
+			break;
+		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30: [[fallthrough]];
+		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64:
+			// The alpha of the 4:4:4:4 packing is not carried by the cable
+			Sampling = VHD_DV_SAMPLING::VHD_DV_SAMPLING_4_4_4_10BITS;
+			ColorSpace = Colorimetry == EDeltacastColorimetry::Rec2020 ? VHD_DV_CS::VHD_DV_CS_BT2020_RGB_FULL : VHD_DV_CS::VHD_DV_CS_RGB_FULL;
 			break;
 		default:
 			UE_LOG(LogDeltacastMedia, Fatal, TEXT("Unsupported buffer packing: %u"), BufferPacking);
@@ -604,7 +625,9 @@ namespace Deltacast::Helpers
 				return true;
 			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8: [[fallthrough]];
 			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_10: [[fallthrough]];
-			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_32:
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_32: [[fallthrough]];
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30: [[fallthrough]];
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64:
 				return false;
 			default:
 				UE_LOG(LogDeltacastMedia, Fatal, TEXT("`IsYuvk` unhandled buffer packing: %u"), BufferPacking);
@@ -846,6 +869,71 @@ namespace Deltacast::Helpers
 		}
 	}
 
+	std::optional<VHD_VIDEOSTANDARD> GetQuadLinkSubImageVideoStandard(const VHD_VIDEOSTANDARD VideoStandard)
+	{
+		switch (VideoStandard)
+		{
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_24Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080p_24Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_25Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080p_25Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_30Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080p_30Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_50Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080p_50Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_60Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080p_60Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160psf_24Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080psf_24Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160psf_25Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080psf_25Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160psf_30Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080psf_30Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_24Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048p_24Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_25Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048p_25Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_30Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048p_30Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_48Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048p_48Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_50Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048p_50Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_60Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048p_60Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160psf_24Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048psf_24Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160psf_25Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048psf_25Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160psf_30Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S2048M_2048psf_30Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_7680x4320p_24Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_24Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_7680x4320p_25Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_25Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_7680x4320p_30Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_30Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_7680x4320p_50Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_50Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_7680x4320p_60Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_3840x2160p_60Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_8192x4320p_24Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_24Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_8192x4320p_25Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_25Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_8192x4320p_30Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_30Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_8192x4320p_48Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_48Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_8192x4320p_50Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_50Hz;
+		case VHD_VIDEOSTANDARD::VHD_VIDEOSTD_8192x4320p_60Hz:
+			return VHD_VIDEOSTANDARD::VHD_VIDEOSTD_4096x2160p_60Hz;
+		default:
+			return {};
+		}
+	}
+
 
 	namespace Internal
 	{
@@ -943,38 +1031,188 @@ namespace Deltacast::Helpers
 	}
 
 
-	std::optional<FVideoCharacteristics> GetVideoCharacteristics(const VHD_VIDEOSTANDARD VideoStandard)
+	// Values returned by VideoMaster, the 8K standards use the values of `FDeltacastSdk::GetVideoCharacteristics_SdkFix`.
+	// Indexed by video standard, the frame rate of interlaced standards is the frame rate and not the field rate.
+	static constexpr std::array<FVideoCharacteristics, static_cast<std::size_t>(VHD_VIDEOSTANDARD::NB_VHD_VIDEOSTANDARDS)> SdiVideoCharacteristicsTable =
+	{{
+		{ 1920, 1080, false,  25 }, // VHD_VIDEOSTD_S274M_1080p_25Hz
+		{ 1920, 1080, false,  30 }, // VHD_VIDEOSTD_S274M_1080p_30Hz
+		{ 1920, 1080, true,   25 }, // VHD_VIDEOSTD_S274M_1080i_50Hz
+		{ 1920, 1080, true,   30 }, // VHD_VIDEOSTD_S274M_1080i_60Hz
+		{ 1280,  720, false,  50 }, // VHD_VIDEOSTD_S296M_720p_50Hz
+		{ 1280,  720, false,  60 }, // VHD_VIDEOSTD_S296M_720p_60Hz
+		{  720,  576, true,   25 }, // VHD_VIDEOSTD_S259M_PAL
+		{  720,  487, true,   30 }, // VHD_VIDEOSTD_S259M_NTSC_487
+		{ 1920, 1080, false,  24 }, // VHD_VIDEOSTD_S274M_1080p_24Hz
+		{ 1920, 1080, false,  60 }, // VHD_VIDEOSTD_S274M_1080p_60Hz
+		{ 1920, 1080, false,  50 }, // VHD_VIDEOSTD_S274M_1080p_50Hz
+		{ 1920, 1080, false,  24 }, // VHD_VIDEOSTD_S274M_1080psf_24Hz
+		{ 1920, 1080, false,  25 }, // VHD_VIDEOSTD_S274M_1080psf_25Hz
+		{ 1920, 1080, false,  30 }, // VHD_VIDEOSTD_S274M_1080psf_30Hz
+		{ 1280,  720, false,  24 }, // VHD_VIDEOSTD_S296M_720p_24Hz
+		{ 1280,  720, false,  25 }, // VHD_VIDEOSTD_S296M_720p_25Hz
+		{ 1280,  720, false,  30 }, // VHD_VIDEOSTD_S296M_720p_30Hz
+		{ 2048, 1080, false,  24 }, // VHD_VIDEOSTD_S2048M_2048p_24Hz
+		{ 2048, 1080, false,  25 }, // VHD_VIDEOSTD_S2048M_2048p_25Hz
+		{ 2048, 1080, false,  30 }, // VHD_VIDEOSTD_S2048M_2048p_30Hz
+		{ 2048, 1080, false,  24 }, // VHD_VIDEOSTD_S2048M_2048psf_24Hz
+		{ 2048, 1080, false,  25 }, // VHD_VIDEOSTD_S2048M_2048psf_25Hz
+		{ 2048, 1080, false,  30 }, // VHD_VIDEOSTD_S2048M_2048psf_30Hz
+		{ 2048, 1080, false,  60 }, // VHD_VIDEOSTD_S2048M_2048p_60Hz
+		{ 2048, 1080, false,  50 }, // VHD_VIDEOSTD_S2048M_2048p_50Hz
+		{ 2048, 1080, false,  48 }, // VHD_VIDEOSTD_S2048M_2048p_48Hz
+		{ 3840, 2160, false,  24 }, // VHD_VIDEOSTD_3840x2160p_24Hz
+		{ 3840, 2160, false,  25 }, // VHD_VIDEOSTD_3840x2160p_25Hz
+		{ 3840, 2160, false,  30 }, // VHD_VIDEOSTD_3840x2160p_30Hz
+		{ 3840, 2160, false,  50 }, // VHD_VIDEOSTD_3840x2160p_50Hz
+		{ 3840, 2160, false,  60 }, // VHD_VIDEOSTD_3840x2160p_60Hz
+		{ 4096, 2160, false,  24 }, // VHD_VIDEOSTD_4096x2160p_24Hz
+		{ 4096, 2160, false,  25 }, // VHD_VIDEOSTD_4096x2160p_25Hz
+		{ 4096, 2160, false,  30 }, // VHD_VIDEOSTD_4096x2160p_30Hz
+		{ 4096, 2160, false,  48 }, // VHD_VIDEOSTD_4096x2160p_48Hz
+		{ 4096, 2160, false,  50 }, // VHD_VIDEOSTD_4096x2160p_50Hz
+		{ 4096, 2160, false,  60 }, // VHD_VIDEOSTD_4096x2160p_60Hz
+		{  720,  480, true,   30 }, // VHD_VIDEOSTD_S259M_NTSC_480
+		{ 7680, 4320, false,  24 }, // VHD_VIDEOSTD_7680x4320p_24Hz
+		{ 7680, 4320, false,  25 }, // VHD_VIDEOSTD_7680x4320p_25Hz
+		{ 7680, 4320, false,  30 }, // VHD_VIDEOSTD_7680x4320p_30Hz
+		{ 7680, 4320, false,  50 }, // VHD_VIDEOSTD_7680x4320p_50Hz
+		{ 7680, 4320, false,  60 }, // VHD_VIDEOSTD_7680x4320p_60Hz
+		{ 3840, 2160, false,  24 }, // VHD_VIDEOSTD_3840x2160psf_24Hz
+		{ 3840, 2160, false,  25 }, // VHD_VIDEOSTD_3840x2160psf_25Hz
+		{ 3840, 2160, false,  30 }, // VHD_VIDEOSTD_3840x2160psf_30Hz
+		{ 4096, 2160, false,  24 }, // VHD_VIDEOSTD_4096x2160psf_24Hz
+		{ 4096, 2160, false,  25 }, // VHD_VIDEOSTD_4096x2160psf_25Hz
+		{ 4096, 2160, false,  30 }, // VHD_VIDEOSTD_4096x2160psf_30Hz
+		{ 8192, 4320, false,  24 }, // VHD_VIDEOSTD_8192x4320p_24Hz
+		{ 8192, 4320, false,  25 }, // VHD_VIDEOSTD_8192x4320p_25Hz
+		{ 8192, 4320, false,  30 }, // VHD_VIDEOSTD_8192x4320p_30Hz
+		{ 8192, 4320, false,  48 }, // VHD_VIDEOSTD_8192x4320p_48Hz
+		{ 8192, 4320, false,  50 }, // VHD_VIDEOSTD_8192x4320p_50Hz
+		{ 8192, 4320, false,  60 }, // VHD_VIDEOSTD_8192x4320p_60Hz
+	}};
+
+	static constexpr std::array<FVideoCharacteristics, static_cast<std::size_t>(VHD_DV_HDMI_VIDEOSTANDARD::NB_VHD_DV_HDMI_VIDEOSTD)> DvVideoCharacteristicsTable =
+	{{
+		{  640,  480, false,  60 }, // VHD_DV_HDMI_VIDEOSTD_640x480p_60Hz
+		{  720,  480, false,  60 }, // VHD_DV_HDMI_VIDEOSTD_720x480p_60Hz
+		{ 1280,  720, false,  60 }, // VHD_DV_HDMI_VIDEOSTD_1280x720p_60Hz
+		{ 1920, 1080, true,   30 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080i_30Hz
+		{  720,  480, true,   30 }, // VHD_DV_HDMI_VIDEOSTD_720x480i_30Hz
+		{ 1920, 1080, false,  60 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080p_60Hz
+		{  720,  576, false,  50 }, // VHD_DV_HDMI_VIDEOSTD_720x576p_50Hz
+		{ 1280,  720, false,  50 }, // VHD_DV_HDMI_VIDEOSTD_1280x720p_50Hz
+		{ 1920, 1080, true,   25 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080i_25Hz
+		{  720,  576, true,   25 }, // VHD_DV_HDMI_VIDEOSTD_720x576i_25Hz
+		{ 1920, 1080, false,  50 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080p_50Hz
+		{ 1920, 1080, false,  24 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080p_24Hz
+		{ 1920, 1080, false,  25 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080p_25Hz
+		{ 1920, 1080, false,  30 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080p_30Hz
+		{ 1920, 1080, true,   50 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080i_50Hz
+		{ 1280,  720, false, 100 }, // VHD_DV_HDMI_VIDEOSTD_1280x720p_100Hz
+		{  720,  576, false, 100 }, // VHD_DV_HDMI_VIDEOSTD_720x576p_100Hz
+		{  720,  576, true,   50 }, // VHD_DV_HDMI_VIDEOSTD_720x576i_50Hz
+		{ 1920, 1080, true,   60 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080i_60Hz
+		{ 1280,  720, false, 120 }, // VHD_DV_HDMI_VIDEOSTD_1280x720p_120Hz
+		{  720,  480, false, 120 }, // VHD_DV_HDMI_VIDEOSTD_720x480p_120Hz
+		{  720,  480, true,   60 }, // VHD_DV_HDMI_VIDEOSTD_720x480i_60Hz
+		{  720,  576, false, 200 }, // VHD_DV_HDMI_VIDEOSTD_720x576p_200Hz
+		{  720,  576, true,  100 }, // VHD_DV_HDMI_VIDEOSTD_720x576i_100Hz
+		{  720,  480, false, 240 }, // VHD_DV_HDMI_VIDEOSTD_720x480p_240Hz
+		{  720,  480, true,  120 }, // VHD_DV_HDMI_VIDEOSTD_720x480i_120Hz
+		{ 1280,  720, false,  24 }, // VHD_DV_HDMI_VIDEOSTD_1280x720p_24Hz
+		{ 1280,  720, false,  25 }, // VHD_DV_HDMI_VIDEOSTD_1280x720p_25Hz
+		{ 1280,  720, false,  30 }, // VHD_DV_HDMI_VIDEOSTD_1280x720p_30Hz
+		{ 1920, 1080, false, 120 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080p_120Hz
+		{ 1920, 1080, false, 100 }, // VHD_DV_HDMI_VIDEOSTD_1920x1080p_100Hz
+		{ 3840, 2160, false,  30 }, // VHD_DV_HDMI_VIDEOSTD_3840x2160p_30Hz
+		{ 3840, 2160, false,  25 }, // VHD_DV_HDMI_VIDEOSTD_3840x2160p_25Hz
+		{ 3840, 2160, false,  24 }, // VHD_DV_HDMI_VIDEOSTD_3840x2160p_24Hz
+		{ 4096, 2160, false,  24 }, // VHD_DV_HDMI_VIDEOSTD_4096x2160p_24Hz
+		{ 3840, 2160, false,  50 }, // VHD_DV_HDMI_VIDEOSTD_3840x2160p_50Hz
+		{ 3840, 2160, false,  60 }, // VHD_DV_HDMI_VIDEOSTD_3840x2160p_60Hz
+		{ 4096, 2160, false,  25 }, // VHD_DV_HDMI_VIDEOSTD_4096x2160p_25Hz
+		{ 4096, 2160, false,  30 }, // VHD_DV_HDMI_VIDEOSTD_4096x2160p_30Hz
+		{ 4096, 2160, false,  50 }, // VHD_DV_HDMI_VIDEOSTD_4096x2160p_50Hz
+		{ 4096, 2160, false,  60 }, // VHD_DV_HDMI_VIDEOSTD_4096x2160p_60Hz
+	}};
+
+	static_assert(SdiVideoCharacteristicsTable[static_cast<std::size_t>(VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S274M_1080i_50Hz)].FrameRate == 25);
+	static_assert(SdiVideoCharacteristicsTable[static_cast<std::size_t>(VHD_VIDEOSTANDARD::VHD_VIDEOSTD_8192x4320p_60Hz)].Width == 8192);
+	static_assert(DvVideoCharacteristicsTable[static_cast<std::size_t>(VHD_DV_HDMI_VIDEOSTANDARD::VHD_DV_HDMI_VIDEOSTD_4096x2160p_60Hz)].Width == 4096);
+
+	// Copies of the tables, entries are only replaced by `ValidateVideoCharacteristics` while the SDK is being loaded
+	static auto SdiVideoCharacteristics = SdiVideoCharacteristicsTable;
+	static auto DvVideoCharacteristics  = DvVideoCharacteristicsTable;
+
+
+	bool FVideoCharacteristics::operator==(const FVideoCharacteristics& Other) const
 	{
-		const auto& DeltacastSdk = FDeltacast::GetSdk();
-
-		FVideoCharacteristics VideoCharacteristics{};
+		return Width == Other.Width && Height == Other.Height && bIsInterlaced == Other.bIsInterlaced && FrameRate == Other.FrameRate;
+	}
 
-		const auto Result = DeltacastSdk.GetVideoCharacteristics_Internal(VideoStandard, &VideoCharacteristics.Width, &VideoCharacteristics.Height,
-			&VideoCharacteristics.bIsInterlaced, &VideoCharacteristics.FrameRate);
 
-		if (!Deltacast::Helpers::IsValid(Result))
+	std::optional<FVideoCharacteristics> GetVideoCharacteristics(const VHD_VIDEOSTANDARD VideoStandard)
+	{
+		const auto Index = static_cast<std::size_t>(VideoStandard);
+		if (Index >= SdiVideoCharacteristics.size())
 		{
 			return {};
 		}
 
-		return VideoCharacteristics;
+		return SdiVideoCharacteristics[Index];
 	}
 
 	std::optional<FVideoCharacteristics> GetVideoCharacteristics(const VHD_DV_HDMI_VIDEOSTANDARD VideoStandard)
 	{
-		const auto& DeltacastSdk = FDeltacast::GetSdk();
+		const auto Index = static_cast<std::size_t>(VideoStandard);
+		if (Index >= DvVideoCharacteristics.size())
+		{
+			return {};
+		}
+
+		return DvVideoCharacteristics[Index];
+	}
 
-		FVideoCharacteristics VideoCharacteristics{};
 
-		const auto Result = DeltacastSdk.GetVideoCharacteristics_Internal(VideoStandard, &VideoCharacteristics.Width, &VideoCharacteristics.Height,
-			&VideoCharacteristics.bIsInterlaced, &VideoCharacteristics.FrameRate);
+	template <typename VideoStandardType, std::size_t Size>
+	static void ValidateVideoCharacteristics(std::array<FVideoCharacteristics, Size>& VideoCharacteristicsTable)
+	{
+		const auto& DeltacastSdk = FDeltacast::GetSdk();
 
-		if (!Deltacast::Helpers::IsValid(Result))
+		for (std::size_t Index = 0; Index < Size; ++Index)
 		{
-			return {};
+			const auto VideoStandard = static_cast<VideoStandardType>(Index);
+
+			FVideoCharacteristics SdkVideoCharacteristics{};
+
+			const auto Result = DeltacastSdk.GetVideoCharacteristics_Internal(VideoStandard, &SdkVideoCharacteristics.Width, &SdkVideoCharacteristics.Height,
+				&SdkVideoCharacteristics.bIsInterlaced, &SdkVideoCharacteristics.FrameRate);
+
+			if (!Deltacast::Helpers::IsValid(Result))
+			{
+				UE_LOG(LogDeltacastMedia, Verbose, TEXT("Video characteristics of %s not available from VideoMaster: %s"),
+				       *GetVideoStandardString(VideoStandard), *GetErrorString(Result));
+				continue;
+			}
+
+			auto& VideoCharacteristics = VideoCharacteristicsTable[Index];
+			if (VideoCharacteristics == SdkVideoCharacteristics)
+			{
+				continue;
+			}
+
+			UE_LOG(LogDeltacastMedia, Warning, TEXT("Video characteristics of %s differ from VideoMaster: %s instead of %s, using VideoMaster values"),
+			       *GetVideoStandardString(VideoStandard), *VideoCharacteristics.ToString(), *SdkVideoCharacteristics.ToString());
+
+			VideoCharacteristics = SdkVideoCharacteristics;
 		}
+	}
 
-		return VideoCharacteristics;
+	void ValidateVideoCharacteristics()
+	{
+		ValidateVideoCharacteristics<VHD_VIDEOSTANDARD>(SdiVideoCharacteristics);
+		ValidateVideoCharacteristics<VHD_DV_HDMI_VIDEOSTANDARD>(DvVideoCharacteristics);
 	}
 
 
@@ -983,6 +1221,7 @@ namespace Deltacast::Helpers
 		ProcessedFrameCount = 0;
 		DroppedFrameCount = 0;
 		BufferFill = 0.0f;
+		FilledSlotCount = 0;
 	}
 
 	void GetStreamStatistics(FStreamStatistics& Statistics, const VHDHandle StreamHandle)
@@ -1008,6 +1247,8 @@ namespace Deltacast::Helpers
 			const auto NewBufferFill = DeltacastSdk.GetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_FILLING);
 			if (NewBufferFill.has_value())
 			{
+				Statistics.FilledSlotCount = static_cast<uint32>(NewBufferFill.value());
+
 				const auto BufferFillPercentage = static_cast<float>(NewBufferFill.value()) / static_cast<float>(Statistics.NumberOfDeltacastBuffers);
 				Statistics.BufferFill = 100.0f * BufferFillPercentage;
 			}
@@ -16,6 +16,7 @@
 #pragma once
 
 #include "DeltacastDefinition.h"
+#include "DeltacastMediaColor.h"
 
 #include "Containers/UnrealString.h"
 
@@ -46,7 +47,8 @@ namespace Deltacast::Helpers
 	struct DELTACASTMEDIA_API FCablePacking final
 	{
 	public:
-		explicit FCablePacking(VHD_BUFFERPACKING BufferPacking, bool IsSd);
+		/** Auto colorimetry is Rec. 601 for SD and Rec. 709 otherwise */
+		explicit FCablePacking(VHD_BUFFERPACKING BufferPacking, bool IsSd, EDeltacastColorimetry Colorimetry = EDeltacastColorimetry::Auto);
 
 	public:
 		VHD_DV_SAMPLING Sampling;
@@ -58,6 +60,9 @@ namespace Deltacast::Helpers
 	inline static constexpr auto GenlockStatusSleepSec = 1.0f / 20.0f;
 	inline static constexpr auto GenlockWaitTimeOutMs = 50ul;
 	inline static constexpr auto MaxGenlockSyncTimeSec = int32{ 15 };
+	inline static constexpr auto GenlockFastStatusSleepSec = 1.0f / 1000.0f;
+	inline static constexpr auto GenlockFastReacquisitionFrameCount = int32{ 10 };
+	inline static constexpr auto DeviceMonitorPeriodMs = uint32{ 1000 };
 
 
 	[[nodiscard]] DELTACASTMEDIA_API FString GetErrorString(VHD_ERRORCODE ErrorCode);
@@ -127,6 +132,9 @@ namespace Deltacast::Helpers
 
 	[[nodiscard]] DELTACASTMEDIA_API EQuadLinkType GetQuadLinkType(VHD_INTERFACE Interface);
 
+	/** Video standard carried by each link of a quad link video standard, none for a standard that is not quad link */
+	[[nodiscard]] DELTACASTMEDIA_API std::optional<VHD_VIDEOSTANDARD> GetQuadLinkSubImageVideoStandard(VHD_VIDEOSTANDARD VideoStandard);
+
 
 	[[nodiscard]] DELTACASTMEDIA_API int32 GetDeviceModeIdentifier(bool bIsEuropean, VHD_VIDEOSTANDARD VideoStandard);
 
@@ -154,12 +162,18 @@ namespace Deltacast::Helpers
 		VHD::ULONG FrameRate;
 
 	public:
+		[[nodiscard]] bool operator==(const FVideoCharacteristics& Other) const;
+
 		[[nodiscard]] FString ToString() const;
 	};
 
+	/** Constant-time lookup in a built-in table, no SDK call */
 	[[nodiscard]] DELTACASTMEDIA_API std::optional<FVideoCharacteristics> GetVideoCharacteristics(VHD_VIDEOSTANDARD VideoStandard);
 	[[nodiscard]] DELTACASTMEDIA_API std::optional<FVideoCharacteristics> GetVideoCharacteristics(VHD_DV_HDMI_VIDEOSTANDARD VideoStandard);
 
+	/** Compares the built-in table to the SDK and keeps the SDK values where they differ, to be called once the SDK is loaded */
+	DELTACASTMEDIA_API void ValidateVideoCharacteristics();
+
 
 	struct DELTACASTMEDIA_API FStreamStatistics final
 	{
@@ -175,6 +189,7 @@ namespace Deltacast::Helpers
 
 		bool   bUpdateBufferFill;
 		float  BufferFill;
+		uint32 FilledSlotCount;
 		uint32 NumberOfDeltacastBuffers;
 	};
 
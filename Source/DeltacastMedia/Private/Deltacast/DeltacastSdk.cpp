@@ -15,7 +15,10 @@
 
 #include "DeltacastSdk.h"
 
+#include "DeltacastBoardRegistry.h"
 #include "DeltacastHelpers.h"
+#include "DeltacastSdkReplay.h"
+#include "DeltacastSdkTrace.h"
 #include "IDeltacastMediaModule.h"
 
 #include <map>
@@ -59,9 +62,10 @@ namespace Deltacast::Utils
 VHD_ERRORCODE FDeltacastSdk::GetApiInfo(VHD::ULONG *ApiVersion, VHD::ULONG *NbBoards) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetApiInfo);
 
 	if (Wrapper_GetApiInfo != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_GetApiInfo(ApiVersion, NbBoards));
+		return TraceScope.Record(Wrapper_GetApiInfo(ApiVersion, NbBoards));
 
 	return FunctionNotLoaded;
 }
@@ -84,6 +88,7 @@ std::optional<bool> FDeltacastSdk::IsBoardIndexValid(const VHD::ULONG BoardIndex
 VHD_ERRORCODE FDeltacastSdk::GetVideoCharacteristics_Internal(const VHD_VIDEOSTANDARD VideoStandard, VHD::ULONG *Width, VHD::ULONG *Height, bool *Interlaced, VHD::ULONG *FrameRate) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetVideoCharacteristics_Internal);
 
 	auto InterlacedValue = Deltacast::Utils::Convert(*Interlaced);
 
@@ -102,7 +107,7 @@ VHD_ERRORCODE FDeltacastSdk::GetVideoCharacteristics_Internal(const VHD_VIDEOSTA
 
 	if (Wrapper_GetVideoCharacteristics != nullptr)
 	{
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_GetVideoCharacteristics(VideoStandard, Width, Height, &InterlacedValue, FrameRate));
+		const auto Result = TraceScope.Record(Wrapper_GetVideoCharacteristics(VideoStandard, Width, Height, &InterlacedValue, FrameRate));
 		Set(Interlaced, Deltacast::Utils::Convert(InterlacedValue));
 		return Result;
 	}
@@ -113,12 +118,13 @@ VHD_ERRORCODE FDeltacastSdk::GetVideoCharacteristics_Internal(const VHD_VIDEOSTA
 VHD_ERRORCODE FDeltacastSdk::GetVideoCharacteristics_Internal(const VHD_DV_HDMI_VIDEOSTANDARD VideoStandard, VHD::ULONG *Width, VHD::ULONG *Height, bool *Interlaced, VHD::ULONG *FrameRate) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetVideoCharacteristics_Internal);
 
 	if (Wrapper_GetVideoCharacteristics != nullptr)
 	{
 		auto InterlacedValue = Deltacast::Utils::Convert(*Interlaced);
 
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_GetHdmiVideoCharacteristics(VideoStandard, Width, Height, &InterlacedValue, FrameRate));
+		const auto Result = TraceScope.Record(Wrapper_GetHdmiVideoCharacteristics(VideoStandard, Width, Height, &InterlacedValue, FrameRate));
 		Set(Interlaced, Deltacast::Utils::Convert(InterlacedValue));
 		return Result;
 	}
@@ -130,6 +136,7 @@ VHD_ERRORCODE FDeltacastSdk::GetVideoCharacteristics_Internal(const VHD_DV_HDMI_
 const char* FDeltacastSdk::GetBoardModel(const VHD::ULONG BoardIndex) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetBoardModel);
 
 	if (Wrapper_GetBoardModel != nullptr)
 		return Wrapper_GetBoardModel(BoardIndex);
@@ -155,9 +162,10 @@ std::optional<VHDHandle> FDeltacastSdk::OpenBoard(const VHD::ULONG BoardIndex)
 VHD_ERRORCODE FDeltacastSdk::CloseBoardHandle(const VHDHandle BoardHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(CloseBoardHandle);
 
 	if (Wrapper_CloseBoardHandle != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_CloseBoardHandle(BoardHandle));
+		return TraceScope.Record(Wrapper_CloseBoardHandle(BoardHandle));
 
 	return FunctionNotLoaded;
 }
@@ -166,12 +174,13 @@ VHD_ERRORCODE FDeltacastSdk::CloseBoardHandle(const VHDHandle BoardHandle)
 VHD_ERRORCODE FDeltacastSdk::GetBoardCapSdiVideoStandard(const VHDHandle BoardHandle, const VHD_STREAMTYPE StreamType, const VHD_VIDEOSTANDARD VideoStandard, bool *IsCapable) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetBoardCapSdiVideoStandard);
 
 	if (Wrapper_GetBoardCapSDIVideoStandard != nullptr)
 	{
 		auto IsCapableValue = Deltacast::Utils::Convert(*IsCapable);
 
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_GetBoardCapSDIVideoStandard(BoardHandle, StreamType, VideoStandard, &IsCapableValue));
+		const auto Result = TraceScope.Record(Wrapper_GetBoardCapSDIVideoStandard(BoardHandle, StreamType, VideoStandard, &IsCapableValue));
 		Set(IsCapable, Deltacast::Utils::Convert(IsCapableValue));
 		return Result;
 	}
@@ -182,12 +191,13 @@ VHD_ERRORCODE FDeltacastSdk::GetBoardCapSdiVideoStandard(const VHDHandle BoardHa
 VHD_ERRORCODE FDeltacastSdk::GetBoardCapSdiInterface(const VHDHandle BoardHandle, const VHD_STREAMTYPE StreamType, const VHD_INTERFACE Interface, bool *IsCapable) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetBoardCapSdiInterface);
 
 	if (Wrapper_GetBoardCapSDIInterface != nullptr)
 	{
 		auto IsCapableValue = Deltacast::Utils::Convert(*IsCapable);
 
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_GetBoardCapSDIInterface(BoardHandle, StreamType, Interface, &IsCapableValue));
+		const auto Result = TraceScope.Record(Wrapper_GetBoardCapSDIInterface(BoardHandle, StreamType, Interface, &IsCapableValue));
 		Set(IsCapable, Deltacast::Utils::Convert(IsCapableValue));
 		return Result;
 	}
@@ -198,12 +208,13 @@ VHD_ERRORCODE FDeltacastSdk::GetBoardCapSdiInterface(const VHDHandle BoardHandle
 VHD_ERRORCODE FDeltacastSdk::GetBoardCapBufferPacking(const VHDHandle BoardHandle, const VHD_BUFFERPACKING BufferPacking, bool *IsCapable) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetBoardCapBufferPacking);
 
 	if (Wrapper_GetBoardCapBufferPacking != nullptr)
 	{
 		auto IsCapableValue = Deltacast::Utils::Convert(*IsCapable);
 
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_GetBoardCapBufferPacking(BoardHandle, BufferPacking, &IsCapableValue));
+		const auto Result = TraceScope.Record(Wrapper_GetBoardCapBufferPacking(BoardHandle, BufferPacking, &IsCapableValue));
 		Set(IsCapable, Deltacast::Utils::Convert(IsCapableValue));
 		return Result;
 	}
@@ -241,9 +252,10 @@ std::optional<VHDHandle> FDeltacastSdk::OpenStream(const VHDHandle BoardHandle,
 VHD_ERRORCODE FDeltacastSdk::CloseStreamHandle(const VHDHandle StreamHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(CloseStreamHandle);
 
 	if (Wrapper_CloseStreamHandle != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_CloseStreamHandle(StreamHandle));
+		return TraceScope.Record(Wrapper_CloseStreamHandle(StreamHandle));
 
 	return FunctionNotLoaded;
 }
@@ -253,12 +265,13 @@ VHD_ERRORCODE FDeltacastSdk::CloseStreamHandle(const VHDHandle StreamHandle)
 VHD_ERRORCODE FDeltacastSdk::PresetTimingStreamProperties(const VHDHandle StreamHandle, const VHD_DV_STANDARD VideoStandard, const VHD::ULONG ActiveWidth, const VHD::ULONG ActiveHeight, const VHD::ULONG RefreshRate, const bool bInterlaced)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(PresetTimingStreamProperties);
 
 	if (Wrapper_PresetTimingStreamProperties != nullptr)
 	{
 		const auto InterlacedValue = Deltacast::Utils::Convert(bInterlaced);
 
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_PresetTimingStreamProperties(StreamHandle, VideoStandard, ActiveWidth, ActiveHeight, RefreshRate, InterlacedValue));
+		const auto Result = TraceScope.Record(Wrapper_PresetTimingStreamProperties(StreamHandle, VideoStandard, ActiveWidth, ActiveHeight, RefreshRate, InterlacedValue));
 		return Result;
 	}
 
@@ -270,9 +283,10 @@ VHD_ERRORCODE FDeltacastSdk::PresetTimingStreamProperties(const VHDHandle Stream
 VHD_ERRORCODE FDeltacastSdk::StartStream(const VHDHandle StreamHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(StartStream);
 
 	if (Wrapper_StartStream != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_StartStream(StreamHandle));
+		return TraceScope.Record(Wrapper_StartStream(StreamHandle));
 
 	return FunctionNotLoaded;
 }
@@ -280,9 +294,10 @@ VHD_ERRORCODE FDeltacastSdk::StartStream(const VHDHandle StreamHandle)
 VHD_ERRORCODE FDeltacastSdk::StopStream(const VHDHandle StreamHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(StopStream);
 
 	if (Wrapper_StopStream != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_StopStream(StreamHandle));
+		return TraceScope.Record(Wrapper_StopStream(StreamHandle));
 
 	return FunctionNotLoaded;
 }
@@ -292,9 +307,10 @@ VHD_ERRORCODE FDeltacastSdk::StopStream(const VHDHandle StreamHandle)
 VHD_ERRORCODE FDeltacastSdk::LockSlotHandle(const VHDHandle StreamHandle, VHDHandle *SlotHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(LockSlotHandle);
 
 	if (Wrapper_LockSlotHandle != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_LockSlotHandle(StreamHandle, SlotHandle));
+		return TraceScope.Record(Wrapper_LockSlotHandle(StreamHandle, SlotHandle));
 
 	return FunctionNotLoaded;
 }
@@ -302,9 +318,10 @@ VHD_ERRORCODE FDeltacastSdk::LockSlotHandle(const VHDHandle StreamHandle, VHDHan
 VHD_ERRORCODE FDeltacastSdk::UnlockSlotHandle(const VHDHandle SlotHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(UnlockSlotHandle);
 
 	if (Wrapper_UnlockSlotHandle != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_UnlockSlotHandle(SlotHandle));
+		return TraceScope.Record(Wrapper_UnlockSlotHandle(SlotHandle));
 
 	return FunctionNotLoaded;
 }
@@ -313,9 +330,10 @@ VHD_ERRORCODE FDeltacastSdk::UnlockSlotHandle(const VHDHandle SlotHandle)
 VHD_ERRORCODE FDeltacastSdk::GetSlotBuffer(const VHDHandle SlotHandle, const VHD::ULONG BufferType, VHD::BYTE **Buffer, VHD::ULONG *BufferSize) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetSlotBuffer);
 
 	if (Wrapper_GetSlotBuffer != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_GetSlotBuffer(SlotHandle, BufferType, Buffer, BufferSize));
+		return TraceScope.Record(Wrapper_GetSlotBuffer(SlotHandle, BufferType, Buffer, BufferSize));
 
 	return FunctionNotLoaded;
 }
@@ -325,9 +343,10 @@ VHD_ERRORCODE FDeltacastSdk::GetSlotBuffer(const VHDHandle SlotHandle, const VHD
 VHD_ERRORCODE FDeltacastSdk::GetSlotTimecode(VHDHandle SlotHandle, VHD_TIMECODE_SOURCE TimecodeSource, VHD_TIMECODE* TimeCode) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetSlotTimecode);
 
 	if (Wrapper_GetSlotTimecode != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_GetSlotTimecode(SlotHandle, TimecodeSource, TimeCode));
+		return TraceScope.Record(Wrapper_GetSlotTimecode(SlotHandle, TimecodeSource, TimeCode));
 
 	return FunctionNotLoaded;
 }
@@ -335,12 +354,13 @@ VHD_ERRORCODE FDeltacastSdk::GetSlotTimecode(VHDHandle SlotHandle, VHD_TIMECODE_
 VHD_ERRORCODE FDeltacastSdk::GetTimecode(const VHDHandle BoardHandle, const VHD_TIMECODE_SOURCE TcSource, bool *Locked, float *FrameRate, VHD_TIMECODE *TimeCode) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetTimecode);
 
 	if (Wrapper_GetTimecode != nullptr)
 	{
 		auto LockedValue = Deltacast::Utils::Convert(*Locked);
 
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_GetTimecode(BoardHandle, TcSource, &LockedValue, FrameRate, TimeCode));
+		const auto Result = TraceScope.Record(Wrapper_GetTimecode(BoardHandle, TcSource, &LockedValue, FrameRate, TimeCode));
 		Set(Locked, Deltacast::Utils::Convert(LockedValue));
 		return Result;
 	}
@@ -351,12 +371,13 @@ VHD_ERRORCODE FDeltacastSdk::GetTimecode(const VHDHandle BoardHandle, const VHD_
 VHD_ERRORCODE FDeltacastSdk::DetectCompanionCard(const VHDHandle BoardHandle, const VHD_COMPANION_CARD_TYPE CompanionCardType, bool *IsPresent) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(DetectCompanionCard);
 
 	if (Wrapper_DetectCompanionCard != nullptr)
 	{
 		auto IsPresentValue = Deltacast::Utils::Convert(*IsPresent);
 
-		const auto Result = static_cast<VHD_ERRORCODE>(Wrapper_DetectCompanionCard(BoardHandle, CompanionCardType, &IsPresentValue));
+		const auto Result = TraceScope.Record(Wrapper_DetectCompanionCard(BoardHandle, CompanionCardType, &IsPresentValue));
 		Set(IsPresent, Deltacast::Utils::Convert(IsPresentValue));
 		return Result;
 	}
@@ -370,9 +391,10 @@ VHD_ERRORCODE FDeltacastSdk::DetectCompanionCard(const VHDHandle BoardHandle, co
 VHD_ERRORCODE FDeltacastSdk::StartTimer(const VHDHandle BoardHandle, const VHD_TIMER_SOURCE Source, VHDHandle *TimerHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(StartTimer);
 
 	if (Wrapper_StartTimer != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_StartTimer(BoardHandle, Source, TimerHandle));
+		return TraceScope.Record(Wrapper_StartTimer(BoardHandle, Source, TimerHandle));
 
 	return FunctionNotLoaded;
 }
@@ -380,9 +402,10 @@ VHD_ERRORCODE FDeltacastSdk::StartTimer(const VHDHandle BoardHandle, const VHD_T
 VHD_ERRORCODE FDeltacastSdk::StopTimer(const VHDHandle TimerHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(StopTimer);
 
 	if (Wrapper_StopTimer != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_StopTimer(TimerHandle));
+		return TraceScope.Record(Wrapper_StopTimer(TimerHandle));
 
 	return FunctionNotLoaded;
 }
@@ -391,9 +414,10 @@ VHD_ERRORCODE FDeltacastSdk::StopTimer(const VHDHandle TimerHandle)
 VHD_ERRORCODE FDeltacastSdk::WaitOnNextTimerTick(const VHDHandle TimerHandle, const VHD::ULONG Timeout) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(WaitOnNextTimerTick);
 
 	if (Wrapper_WaitOnNextTimerTick != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_WaitOnNextTimerTick(TimerHandle, Timeout));
+		return TraceScope.Record(Wrapper_WaitOnNextTimerTick(TimerHandle, Timeout));
 
 	return FunctionNotLoaded;
 }
@@ -702,16 +726,37 @@ void FDeltacastSdk::SetLoopbackState(const VHDHandle BoardHandle, const VHD::ULO
 
 
 
+Deltacast::DynamicLibrary::DynamicLibraryStatus FDeltacastSdk::Load(const wchar_t* LibraryName)
+{
+	if (Deltacast::SdkReplay::GetMode() != Deltacast::SdkReplay::EMode::Replay)
+	{
+		return DynamicLibraryLoader::Load(LibraryName);
+	}
+
+	bIsReplaying = true;
+
+	return LoadAllFunctionAddress();
+}
+
+void FDeltacastSdk::Unload()
+{
+	DynamicLibraryLoader::Unload();
+
+	bIsReplaying = false;
+}
+
 Deltacast::DynamicLibrary::DynamicLibraryStatus FDeltacastSdk::LoadAllFunctionAddress()
 {
+	// When recording or replaying a SDK trace, the wrappers point to the trace functions instead of the SDK ones
 #define LoadFunction(FunctionName) \
     { \
-        Wrapper_##FunctionName = GetFunctionPointer<VHD_##FunctionName>(L"VHD_" #FunctionName); \
-		if (Wrapper_##FunctionName == nullptr) \
+        Wrapper_##FunctionName = bIsReplaying ? nullptr : GetFunctionPointer<VHD_##FunctionName>(L"VHD_" #FunctionName); \
+		if (Wrapper_##FunctionName == nullptr && !bIsReplaying) \
 		{ \
 		    UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to load: %s"), TEXT("VHD_" #FunctionName)); \
 		    return Deltacast::DynamicLibrary::DynamicLibraryStatus::get_function_address_failed; \
 		} \
+        Wrapper_##FunctionName = Deltacast::SdkReplay::Hook<Deltacast::SdkReplay::EEntryPoint::FunctionName>(Wrapper_##FunctionName); \
     }
 
 	LoadFunction(GetApiInfo);
@@ -765,9 +810,10 @@ Deltacast::DynamicLibrary::DynamicLibraryStatus FDeltacastSdk::LoadAllFunctionAd
 VHD_ERRORCODE FDeltacastSdk::OpenBoardHandle(const VHD::ULONG BoardIndex, VHDHandle *BoardHandle, const VHDHandle OnStateChangeEvent, const VHD::ULONG StateChangeMask)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(OpenBoardHandle);
 
 	if (Wrapper_OpenBoardHandle != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_OpenBoardHandle(BoardIndex, BoardHandle, OnStateChangeEvent, StateChangeMask));
+		return TraceScope.Record(Wrapper_OpenBoardHandle(BoardIndex, BoardHandle, OnStateChangeEvent, StateChangeMask));
 
 	return FunctionNotLoaded;
 }
@@ -776,9 +822,10 @@ VHD_ERRORCODE FDeltacastSdk::OpenBoardHandle(const VHD::ULONG BoardIndex, VHDHan
 VHD_ERRORCODE FDeltacastSdk::GetBoardCapability(const VHDHandle BoardHandle, const VHD_CORE_BOARD_CAPABILITY BoardCapability, VHD::ULONG* Value) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetBoardCapability);
 
 	if (Wrapper_GetBoardCapability != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_GetBoardCapability(BoardHandle, BoardCapability, Value));
+		return TraceScope.Record(Wrapper_GetBoardCapability(BoardHandle, BoardCapability, Value));
 
 	return FunctionNotLoaded;
 }
@@ -787,9 +834,10 @@ VHD_ERRORCODE FDeltacastSdk::GetBoardCapability(const VHDHandle BoardHandle, con
 VHD_ERRORCODE FDeltacastSdk::GetBoardProperty(const VHDHandle BoardHandle, const VHD::ULONG Property, VHD::ULONG* Value) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetBoardProperty);
 
 	if (Wrapper_GetBoardProperty != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_GetBoardProperty(BoardHandle, Property, Value));
+		return TraceScope.Record(Wrapper_GetBoardProperty(BoardHandle, Property, Value));
 
 	return FunctionNotLoaded;
 }
@@ -797,9 +845,10 @@ VHD_ERRORCODE FDeltacastSdk::GetBoardProperty(const VHDHandle BoardHandle, const
 VHD_ERRORCODE FDeltacastSdk::SetBoardProperty(const VHDHandle BoardHandle, const VHD::ULONG Property, const VHD::ULONG Value)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(SetBoardProperty);
 
 	if (Wrapper_SetBoardProperty != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_SetBoardProperty(BoardHandle, Property, Value));
+		return TraceScope.Record(Wrapper_SetBoardProperty(BoardHandle, Property, Value));
 
 	return FunctionNotLoaded;
 }
@@ -809,9 +858,10 @@ VHD_ERRORCODE FDeltacastSdk::SetBoardProperty(const VHDHandle BoardHandle, const
 VHD_ERRORCODE FDeltacastSdk::OpenStreamHandle(const VHDHandle BoardHandle, const VHD::ULONG StreamType, const VHD::ULONG ProcessingMode, VHDHandle* StreamHandle)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(OpenStreamHandle);
 
 	if (Wrapper_OpenStreamHandle != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_OpenStreamHandle(BoardHandle, StreamType, ProcessingMode, nullptr, StreamHandle, VHD::InvalidHandle));
+		return TraceScope.Record(Wrapper_OpenStreamHandle(BoardHandle, StreamType, ProcessingMode, nullptr, StreamHandle, VHD::InvalidHandle));
 
 	return FunctionNotLoaded;
 }
@@ -830,9 +880,10 @@ std::optional<VHD::ULONG> FDeltacastSdk::GetStreamProperty(const VHDHandle Strea
 VHD_ERRORCODE FDeltacastSdk::GetStreamProperty(const VHDHandle StreamHandle, const VHD::ULONG Property, VHD::ULONG* Value) const
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(GetStreamProperty);
 
 	if (Wrapper_GetStreamProperty != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_GetStreamProperty(StreamHandle, Property, Value));
+		return TraceScope.Record(Wrapper_GetStreamProperty(StreamHandle, Property, Value));
 
 	return FunctionNotLoaded;
 }
@@ -841,9 +892,10 @@ VHD_ERRORCODE FDeltacastSdk::GetStreamProperty(const VHDHandle StreamHandle, con
 VHD_ERRORCODE FDeltacastSdk::SetStreamProperty(const VHDHandle StreamHandle, const VHD::ULONG Property, const VHD::ULONG Value)
 {
 	WRAPPER_LOG_TIME();
+	DELTACAST_SDK_TRACE_SCOPE(SetStreamProperty);
 
 	if (Wrapper_SetStreamProperty != nullptr)
-		return static_cast<VHD_ERRORCODE>(Wrapper_SetStreamProperty(StreamHandle, Property, Value));
+		return TraceScope.Record(Wrapper_SetStreamProperty(StreamHandle, Property, Value));
 
 	return FunctionNotLoaded;
 }
@@ -876,6 +928,8 @@ bool FDeltacast::Initialize()
 {
 	auto& DeltacastSdk = GetSdk();
 
+	Deltacast::SdkReplay::Initialize();
+
 	const auto LoadStatus = DeltacastSdk.Load(LibraryName);
 	if (LoadStatus != Deltacast::DynamicLibrary::DynamicLibraryStatus::ok)
 	{
@@ -896,18 +950,24 @@ bool FDeltacast::Initialize()
 		UE_LOG(LogDeltacastMedia, Error, TEXT("Cannot get VideoMaster general information"));
 	}
 
+	Deltacast::Helpers::ValidateVideoCharacteristics();
+
 	return true;
 }
 
 void FDeltacast::Shutdown()
 {
+	GetBoardRegistry().Reset();
+
 	GetSdk().Unload();
+
+	Deltacast::SdkReplay::Shutdown();
 }
 
 
 bool FDeltacast::IsInitialized()
 {
-	return GetSdk().IsLoaded();
+	return GetSdk().IsLoaded() || GetSdk().IsReplaying();
 }
 
 FDeltacastSdk& FDeltacast::GetSdk()
@@ -917,6 +977,13 @@ FDeltacastSdk& FDeltacast::GetSdk()
 	return DeltacastSdk;
 }
 
+FDeltacastBoardRegistry& FDeltacast::GetBoardRegistry()
+{
+	static FDeltacastBoardRegistry BoardRegistry;
+
+	return BoardRegistry;
+}
+
 FName FDeltacast::GetProtocolName()
 {
 	static const FName ProtocolName = TEXT("deltacast");
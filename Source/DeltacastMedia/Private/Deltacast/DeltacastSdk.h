@@ -34,6 +34,14 @@ public:
 	FDeltacastSdk(const FDeltacastSdk &Other)     = delete;
 	FDeltacastSdk(FDeltacastSdk &&Other) noexcept = delete;
 
+public: //~ Deltacast::DynamicLibrary::DynamicLibraryLoader
+	/** Skips the library and binds the SDK functions to the recorded calls when replaying a SDK trace */
+	virtual Deltacast::DynamicLibrary::DynamicLibraryStatus Load(const wchar_t* LibraryName) override;
+
+	void Unload();
+
+	[[nodiscard]] bool IsReplaying() const { return bIsReplaying; }
+
 public:
 	// General
 	[[nodiscard]] VHD_ERRORCODE GetApiInfo(VHD::ULONG *ApiVersion, VHD::ULONG *NbBoards) const;
@@ -185,12 +193,17 @@ private:
 	VHD_StopTimer Wrapper_StopTimer = nullptr;
 	VHD_WaitOnNextTimerTick Wrapper_WaitOnNextTimerTick = nullptr;
 	
+private:
+	bool bIsReplaying = false;
+
 private:
 	inline static constexpr VHD_ERRORCODE FunctionNotLoaded = static_cast<VHD_ERRORCODE>(std::numeric_limits<VHD::ULONG>::max());
 };
 
 
 
+class FDeltacastBoardRegistry;
+
 class DELTACASTMEDIA_API FDeltacast
 {
 public:
@@ -203,6 +216,9 @@ public:
 
 	static FDeltacastSdk& GetSdk();
 
+	/** Board handles shared between the Deltacast users, prefer it over `FDeltacastSdk::OpenBoard` */
+	static FDeltacastBoardRegistry& GetBoardRegistry();
+
 	static FName GetProtocolName();
 
 private:
@@ -0,0 +1,356 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastSdkReplay.h"
+
+#include "IDeltacastMediaModule.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/Archive.h"
+
+#include <atomic>
+
+
+
+namespace Deltacast::SdkReplay
+{
+	static constexpr uint32 TraceMagic         = 0x52534344; // "DCSR"
+	static constexpr uint32 TraceFormatVersion = 1;
+
+	/** Number of records of an entry point looked at to find one with the same inputs */
+	static constexpr int32 MatchLookahead = 64;
+
+
+	FArchive& operator<<(FArchive& Ar, FCallRecord& CallRecord)
+	{
+		auto EntryPoint = static_cast<uint16>(CallRecord.EntryPoint);
+
+		Ar << EntryPoint;
+		Ar << CallRecord.ThreadId << CallRecord.StartUs << CallRecord.DurationUs;
+		Ar << CallRecord.Result;
+		Ar << CallRecord.Inputs << CallRecord.Outputs;
+		Ar << CallRecord.Text;
+
+		CallRecord.EntryPoint = static_cast<EEntryPoint>(EntryPoint);
+
+		return Ar;
+	}
+
+
+	struct FEntryPointRecords
+	{
+		TArray<FCallRecord> Records;
+		TArray<bool>        Consumed;
+
+		/** First record not consumed yet */
+		int32 Cursor = 0;
+	};
+
+	struct FReplayState
+	{
+		EMode   Mode = EMode::Disabled;
+		FString Path;
+
+		bool bFastReplay = false;
+
+		uint64 StartCycles = 0;
+
+		FCriticalSection CriticalSection;
+
+		TUniquePtr<FArchive> Writer;
+		uint64               RecordedCallCount = 0;
+
+		TArray<FEntryPointRecords> EntryPoints;
+		uint64                     ReplayedCallCount  = 0;
+		uint64                     MismatchedCallCount = 0;
+		uint64                     MissingCallCount    = 0;
+		uint64                     RecordedDurationUs  = 0;
+
+		/** Never released, the replayed strings outlive the records freed by `Shutdown` */
+		TArray<TUniquePtr<TArray<ANSICHAR>>> KeptTexts;
+	};
+
+	static FReplayState& GetState()
+	{
+		static FReplayState State;
+
+		return State;
+	}
+
+
+	static bool OpenRecording(FReplayState& State)
+	{
+		State.Writer = TUniquePtr<FArchive>(IFileManager::Get().CreateFileWriter(*State.Path));
+		if (!State.Writer.IsValid())
+		{
+			UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to create the SDK trace %s"), *State.Path);
+			return false;
+		}
+
+		auto Magic         = TraceMagic;
+		auto FormatVersion = TraceFormatVersion;
+		*State.Writer << Magic << FormatVersion;
+
+		return true;
+	}
+
+	static bool OpenReplay(FReplayState& State)
+	{
+		const TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*State.Path));
+		if (!Reader.IsValid())
+		{
+			UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to open the SDK trace %s"), *State.Path);
+			return false;
+		}
+
+		uint32 Magic         = 0;
+		uint32 FormatVersion = 0;
+		*Reader << Magic << FormatVersion;
+
+		if (Magic != TraceMagic || FormatVersion != TraceFormatVersion)
+		{
+			UE_LOG(LogDeltacastMedia, Error, TEXT("%s is not a supported SDK trace"), *State.Path);
+			return false;
+		}
+
+		State.EntryPoints.SetNum(static_cast<int32>(EEntryPoint::Count));
+
+		uint64 CallCount = 0;
+		while (!Reader->AtEnd() && !Reader->IsError())
+		{
+			FCallRecord CallRecord;
+			*Reader << CallRecord;
+
+			if (Reader->IsError() || CallRecord.EntryPoint >= EEntryPoint::Count)
+			{
+				UE_LOG(LogDeltacastMedia, Warning, TEXT("SDK trace %s is truncated after %llu calls"), *State.Path, CallCount);
+				break;
+			}
+
+			State.RecordedDurationUs = FMath::Max(State.RecordedDurationUs, CallRecord.StartUs + CallRecord.DurationUs);
+
+			auto& EntryPointRecords = State.EntryPoints[static_cast<int32>(CallRecord.EntryPoint)];
+			EntryPointRecords.Records.Add(MoveTemp(CallRecord));
+			EntryPointRecords.Consumed.Add(false);
+
+			++CallCount;
+		}
+
+		UE_LOG(LogDeltacastMedia, Display, TEXT("Replaying %llu SDK calls from %s%s"),
+		       CallCount, *State.Path, State.bFastReplay ? TEXT(" as fast as possible") : TEXT(" with their recorded timing"));
+
+		return true;
+	}
+
+
+	void Initialize()
+	{
+		auto& State = GetState();
+
+		FScopeLock Lock(&State.CriticalSection);
+
+		State.Mode        = EMode::Disabled;
+		State.StartCycles = FPlatformTime::Cycles64();
+
+		if (FParse::Value(FCommandLine::Get(), TEXT("DeltacastSdkReplay="), State.Path))
+		{
+			State.bFastReplay = FParse::Param(FCommandLine::Get(), TEXT("DeltacastSdkReplayFast"));
+
+			if (OpenReplay(State))
+			{
+				State.Mode = EMode::Replay;
+			}
+		}
+		else if (FParse::Value(FCommandLine::Get(), TEXT("DeltacastSdkRecord="), State.Path))
+		{
+			if (OpenRecording(State))
+			{
+				State.Mode = EMode::Record;
+
+				UE_LOG(LogDeltacastMedia, Display, TEXT("Recording the SDK calls to %s"), *State.Path);
+			}
+		}
+	}
+
+	void Shutdown()
+	{
+		auto& State = GetState();
+
+		FScopeLock Lock(&State.CriticalSection);
+
+		if (State.Mode == EMode::Record)
+		{
+			State.Writer->Close();
+			State.Writer.Reset();
+
+			UE_LOG(LogDeltacastMedia, Display, TEXT("Recorded %llu SDK calls to %s"), State.RecordedCallCount, *State.Path);
+		}
+		else if (State.Mode == EMode::Replay)
+		{
+			UE_LOG(LogDeltacastMedia, Display, TEXT("Replayed %llu SDK calls in %.3f s (recorded session: %.3f s), %llu matched another call, %llu were missing from the trace"),
+			       State.ReplayedCallCount, static_cast<double>(GetTimestampUs()) / 1e6, static_cast<double>(State.RecordedDurationUs) / 1e6,
+			       State.MismatchedCallCount, State.MissingCallCount);
+
+			State.EntryPoints.Reset();
+		}
+
+		// The SDK function pointers may still point to the replay functions until the SDK is unloaded, keep the mode
+	}
+
+	EMode GetMode()
+	{
+		return GetState().Mode;
+	}
+
+	uint64 GetTimestampUs()
+	{
+		return static_cast<uint64>(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - GetState().StartCycles) * 1e6);
+	}
+
+
+	void WriteRecord(FCallRecord&& CallRecord)
+	{
+		auto& State = GetState();
+
+		CallRecord.ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+		FScopeLock Lock(&State.CriticalSection);
+
+		if (State.Writer.IsValid())
+		{
+			*State.Writer << CallRecord;
+			++State.RecordedCallCount;
+		}
+	}
+
+	const FCallRecord* ConsumeRecord(const EEntryPoint EntryPoint, const TArray<uint64>& Inputs)
+	{
+		auto& State = GetState();
+
+		FScopeLock Lock(&State.CriticalSection);
+
+		if (!State.EntryPoints.IsValidIndex(static_cast<int32>(EntryPoint)))
+		{
+			++State.MissingCallCount;
+			return nullptr;
+		}
+
+		auto& EntryPointRecords = State.EntryPoints[static_cast<int32>(EntryPoint)];
+
+		const auto LastIndex = FMath::Min(EntryPointRecords.Cursor + MatchLookahead, EntryPointRecords.Records.Num());
+
+		int32 MatchIndex = INDEX_NONE;
+		int32 FirstFreeIndex = INDEX_NONE;
+		for (int32 Index = EntryPointRecords.Cursor; Index < LastIndex; ++Index)
+		{
+			if (EntryPointRecords.Consumed[Index])
+			{
+				continue;
+			}
+
+			if (FirstFreeIndex == INDEX_NONE)
+			{
+				FirstFreeIndex = Index;
+			}
+
+			if (EntryPointRecords.Records[Index].Inputs == Inputs)
+			{
+				MatchIndex = Index;
+				break;
+			}
+		}
+
+		if (MatchIndex == INDEX_NONE)
+		{
+			if (FirstFreeIndex == INDEX_NONE)
+			{
+				++State.MissingCallCount;
+				return nullptr;
+			}
+
+			MatchIndex = FirstFreeIndex;
+			++State.MismatchedCallCount;
+		}
+
+		EntryPointRecords.Consumed[MatchIndex] = true;
+		while (EntryPointRecords.Cursor < EntryPointRecords.Records.Num() && EntryPointRecords.Consumed[EntryPointRecords.Cursor])
+		{
+			++EntryPointRecords.Cursor;
+		}
+
+		++State.ReplayedCallCount;
+
+		return &EntryPointRecords.Records[MatchIndex];
+	}
+
+	const char* KeepText(const TArray<ANSICHAR>& Text)
+	{
+		auto& State = GetState();
+
+		FScopeLock Lock(&State.CriticalSection);
+
+		for (const auto& KeptText : State.KeptTexts)
+		{
+			if (*KeptText == Text)
+			{
+				return KeptText->GetData();
+			}
+		}
+
+		return State.KeptTexts.Add_GetRef(MakeUnique<TArray<ANSICHAR>>(Text))->GetData();
+	}
+
+	void WaitForRecordedDuration(const FCallRecord& CallRecord, const uint64 ReplayStartUs)
+	{
+		if (GetState().bFastReplay)
+		{
+			return;
+		}
+
+		const auto EndUs = ReplayStartUs + CallRecord.DurationUs;
+
+		for (auto NowUs = GetTimestampUs(); NowUs < EndUs; NowUs = GetTimestampUs())
+		{
+			const auto RemainingUs = EndUs - NowUs;
+
+			// Sleeping is too coarse for the last millisecond
+			if (RemainingUs > 2000)
+			{
+				FPlatformProcess::SleepNoStats(static_cast<float>(RemainingUs - 1000) / 1e6f);
+			}
+			else
+			{
+				FPlatformProcess::YieldThread();
+			}
+		}
+	}
+
+	VHD::BYTE* GetReplayBuffer(const VHD::ULONG Size)
+	{
+		static thread_local TArray<VHD::BYTE> ReplayBuffer;
+
+		if (static_cast<VHD::ULONG>(ReplayBuffer.Num()) < Size)
+		{
+			ReplayBuffer.SetNumZeroed(static_cast<int32>(Size));
+		}
+
+		return ReplayBuffer.GetData();
+	}
+}
@@ -0,0 +1,289 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "DeltacastDefinition.h"
+
+#include "Containers/Array.h"
+#include "HAL/UnrealMemory.h"
+#include "Misc/CString.h"
+
+#include <limits>
+#include <type_traits>
+
+
+
+/**
+ * Records the SDK calls of a session to a binary trace and serves them back without a board.
+ * `-DeltacastSdkRecord=<File>` records every call, its arguments, outputs, result and duration.
+ * `-DeltacastSdkReplay=<File>` replays the calls with their recorded duration, add `-DeltacastSdkReplayFast` to return immediately.
+ */
+namespace Deltacast::SdkReplay
+{
+	enum class EMode : uint8
+	{
+		Disabled,
+		Record,
+		Replay,
+	};
+
+	/** Named like the `FDeltacastSdk::LoadAllFunctionAddress` entries, the values are stored in the trace */
+	enum class EEntryPoint : uint16
+	{
+		GetApiInfo,
+		GetVideoCharacteristics,
+		GetHdmiVideoCharacteristics,
+		OpenBoardHandle,
+		CloseBoardHandle,
+		GetBoardModel,
+		GetBoardProperty,
+		GetBoardCapability,
+		GetBoardCapSDIVideoStandard,
+		GetBoardCapSDIInterface,
+		GetBoardCapBufferPacking,
+		SetBoardProperty,
+		OpenStreamHandle,
+		CloseStreamHandle,
+		GetStreamProperty,
+		SetStreamProperty,
+		PresetTimingStreamProperties,
+		StartStream,
+		StopStream,
+		LockSlotHandle,
+		UnlockSlotHandle,
+		GetSlotBuffer,
+		GetSlotTimecode,
+		GetTimecode,
+		DetectCompanionCard,
+		StartTimer,
+		StopTimer,
+		WaitOnNextTimerTick,
+
+		Count
+	};
+
+	struct FCallRecord
+	{
+		EEntryPoint EntryPoint = EEntryPoint::Count;
+
+		uint32 ThreadId   = 0;
+		uint64 StartUs    = 0;
+		uint64 DurationUs = 0;
+
+		uint64 Result = 0;
+
+		/** Scalar arguments and handles, 0 for the output pointers */
+		TArray<uint64> Inputs;
+
+		/** Value written by the SDK behind each output pointer, empty for the other arguments */
+		TArray<TArray<uint8>> Outputs;
+
+		/** Returned string, null-terminated, for the entry points returning one */
+		TArray<ANSICHAR> Text;
+	};
+
+	/** Result of a replayed call missing from the trace */
+	inline static constexpr VHD::ULONG MissingCallResult = std::numeric_limits<VHD::ULONG>::max() - 1;
+
+
+	/** Opens the trace given on the command line, to be called before loading the SDK */
+	DELTACASTMEDIA_API void Initialize();
+	DELTACASTMEDIA_API void Shutdown();
+
+	[[nodiscard]] DELTACASTMEDIA_API EMode GetMode();
+
+	[[nodiscard]] DELTACASTMEDIA_API uint64 GetTimestampUs();
+
+	DELTACASTMEDIA_API void WriteRecord(FCallRecord&& CallRecord);
+
+	/** Next recorded call of the entry point, preferring one made with the same inputs, nullptr when there is none left */
+	[[nodiscard]] DELTACASTMEDIA_API const FCallRecord* ConsumeRecord(EEntryPoint EntryPoint, const TArray<uint64>& Inputs);
+
+	/** Returns once the call lasted as long as when it was recorded, immediately in fast replay */
+	DELTACASTMEDIA_API void WaitForRecordedDuration(const FCallRecord& CallRecord, uint64 ReplayStartUs);
+
+	/** Per-thread buffer handed out in place of the slot buffers */
+	[[nodiscard]] DELTACASTMEDIA_API VHD::BYTE* GetReplayBuffer(VHD::ULONG Size);
+
+	/** Copy of a replayed string kept until the process exits, as the strings returned by the SDK */
+	[[nodiscard]] DELTACASTMEDIA_API const char* KeepText(const TArray<ANSICHAR>& Text);
+
+
+	namespace Internal
+	{
+		template <typename T>
+		inline constexpr bool IsOutputPointer = std::is_pointer_v<T> && !std::is_same_v<T, VHDHandle> && !std::is_const_v<std::remove_pointer_t<T>>;
+
+		template <typename T>
+		uint64 ToInput(const T Value)
+		{
+			if constexpr (std::is_same_v<T, VHDHandle>)
+			{
+				return static_cast<uint64>(reinterpret_cast<UPTRINT>(Value));
+			}
+			else if constexpr (std::is_pointer_v<T>)
+			{
+				return 0;
+			}
+			else
+			{
+				return static_cast<uint64>(Value);
+			}
+		}
+
+		template <typename T>
+		TArray<uint8> ToOutput(const T Value)
+		{
+			TArray<uint8> Bytes;
+
+			// Slot buffers are not recorded, only their size
+			if constexpr (IsOutputPointer<T> && !std::is_same_v<T, VHD::BYTE**>)
+			{
+				if (Value != nullptr)
+				{
+					Bytes.SetNumUninitialized(sizeof(*Value));
+					FMemory::Memcpy(Bytes.GetData(), Value, sizeof(*Value));
+				}
+			}
+
+			return Bytes;
+		}
+
+		/** Writes the recorded outputs back, the slot buffer is sized from the buffer size argument that follows it */
+		struct FOutputRestorer
+		{
+			template <typename T>
+			void Restore(const T Value, const TArray<uint8>& Bytes)
+			{
+				if constexpr (std::is_same_v<T, VHD::BYTE**>)
+				{
+					PendingBuffer = Value;
+				}
+				else if constexpr (IsOutputPointer<T>)
+				{
+					if (Value == nullptr || Bytes.Num() != sizeof(*Value))
+					{
+						return;
+					}
+
+					FMemory::Memcpy(Value, Bytes.GetData(), sizeof(*Value));
+
+					if constexpr (std::is_same_v<T, VHD::ULONG*>)
+					{
+						if (PendingBuffer != nullptr)
+						{
+							*PendingBuffer = GetReplayBuffer(*Value);
+							PendingBuffer  = nullptr;
+						}
+					}
+				}
+			}
+
+			VHD::BYTE** PendingBuffer = nullptr;
+		};
+
+		template <typename Return>
+		void SetResult(FCallRecord& CallRecord, const Return Result)
+		{
+			if constexpr (std::is_same_v<Return, const char*>)
+			{
+				if (Result != nullptr)
+				{
+					CallRecord.Text.Append(Result, static_cast<int32>(FCStringAnsi::Strlen(Result)) + 1);
+				}
+			}
+			else
+			{
+				CallRecord.Result = static_cast<uint64>(Result);
+			}
+		}
+
+		template <typename Return>
+		Return GetResult(const FCallRecord* CallRecord)
+		{
+			if constexpr (std::is_same_v<Return, const char*>)
+			{
+				return CallRecord != nullptr && !CallRecord->Text.IsEmpty() ? KeepText(CallRecord->Text) : nullptr;
+			}
+			else
+			{
+				return static_cast<Return>(CallRecord != nullptr ? CallRecord->Result : MissingCallResult);
+			}
+		}
+	}
+
+
+	template <EEntryPoint EntryPoint, typename Function>
+	struct TEntryPoint;
+
+	template <EEntryPoint EntryPoint, typename Return, typename... Args>
+	struct TEntryPoint<EntryPoint, Return(*)(Args...)>
+	{
+		inline static Return (*SdkFunction)(Args...) = nullptr;
+
+		static Return Record(Args... InArgs)
+		{
+			FCallRecord CallRecord;
+			CallRecord.EntryPoint = EntryPoint;
+			CallRecord.Inputs     = { Internal::ToInput(InArgs)... };
+			CallRecord.StartUs    = GetTimestampUs();
+
+			const auto Result = SdkFunction(InArgs...);
+
+			CallRecord.DurationUs = GetTimestampUs() - CallRecord.StartUs;
+			CallRecord.Outputs    = { Internal::ToOutput(InArgs)... };
+			Internal::SetResult(CallRecord, Result);
+
+			WriteRecord(MoveTemp(CallRecord));
+
+			return Result;
+		}
+
+		static Return Replay(Args... InArgs)
+		{
+			const auto ReplayStartUs = GetTimestampUs();
+
+			const auto CallRecord = ConsumeRecord(EntryPoint, { Internal::ToInput(InArgs)... });
+			if (CallRecord != nullptr && CallRecord->Outputs.Num() == sizeof...(Args))
+			{
+				Internal::FOutputRestorer OutputRestorer;
+
+				[[maybe_unused]] int32 ArgIndex = 0;
+				(OutputRestorer.Restore(InArgs, CallRecord->Outputs[ArgIndex++]), ...);
+
+				WaitForRecordedDuration(*CallRecord, ReplayStartUs);
+			}
+
+			return Internal::GetResult<Return>(CallRecord);
+		}
+	};
+
+	/** Returns the function to call for the entry point in the current mode */
+	template <EEntryPoint EntryPoint, typename Function>
+	Function Hook(const Function LoadedFunction)
+	{
+		switch (GetMode())
+		{
+		case EMode::Record:
+			TEntryPoint<EntryPoint, Function>::SdkFunction = LoadedFunction;
+			return &TEntryPoint<EntryPoint, Function>::Record;
+		case EMode::Replay:
+			return &TEntryPoint<EntryPoint, Function>::Replay;
+		default:
+			return LoadedFunction;
+		}
+	}
+}
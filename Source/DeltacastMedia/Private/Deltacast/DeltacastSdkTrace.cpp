@@ -0,0 +1,300 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastSdkTrace.h"
+
+#include "DeltacastHelpers.h"
+#include "IDeltacastMediaModule.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+
+
+namespace Deltacast::SdkTrace
+{
+	static bool bTraceEnabled = false;
+
+	static FAutoConsoleVariableRef CVarDeltacastSdkTrace(
+		TEXT("Deltacast.Sdk.Trace"),
+		bTraceEnabled,
+		TEXT("Record call count, latency and error codes of each Deltacast SDK entry point (see Deltacast.Sdk.DumpStats)."),
+		ECVF_Default);
+
+
+	struct FEntryPointStats
+	{
+		std::atomic<uint64> CallCount   = 0;
+		std::atomic<uint64> TotalCycles = 0;
+		std::atomic<uint64> MaxCycles   = 0;
+
+		std::array<std::atomic<uint32>, MaxTrackedErrorCode + 1> ErrorCodeCounts = {};
+	};
+
+	/** Written by a single thread at a time, read by the dump */
+	struct FThreadStats
+	{
+		std::array<FEntryPointStats, MaxEntryPoints> EntryPoints;
+
+		std::atomic<bool> bInUse = false;
+	};
+
+
+	class FTraceRegistry final
+	{
+	public:
+		int32 RegisterEntryPoint(const TCHAR* Name)
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			const auto ExistingIndex = EntryPointNames.IndexOfByKey(FString(Name));
+			if (ExistingIndex != INDEX_NONE)
+			{
+				return ExistingIndex;
+			}
+
+			if (EntryPointNames.Num() >= MaxEntryPoints)
+			{
+				UE_LOG(LogDeltacastMedia, Warning, TEXT("Too many SDK entry points to trace, %s is not traced"), Name);
+				return INDEX_NONE;
+			}
+
+			return EntryPointNames.Add(Name);
+		}
+
+		/** Reuses the counters of a thread that exited, so the totals survive the stream threads */
+		FThreadStats* AcquireThreadStats()
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			for (const auto& ThreadStats : AllThreadStats)
+			{
+				if (!ThreadStats->bInUse.exchange(true))
+				{
+					return ThreadStats.Get();
+				}
+			}
+
+			auto& ThreadStats = AllThreadStats.Add_GetRef(MakeUnique<FThreadStats>());
+			ThreadStats->bInUse = true;
+
+			return ThreadStats.Get();
+		}
+
+		FString GetStatsString()
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			struct FSummary
+			{
+				int32  EntryPoint  = INDEX_NONE;
+				uint64 CallCount   = 0;
+				uint64 TotalCycles = 0;
+				uint64 MaxCycles   = 0;
+
+				std::array<uint64, MaxTrackedErrorCode + 1> ErrorCodeCounts = {};
+			};
+
+			TArray<FSummary> Summaries;
+			for (int32 EntryPoint = 0; EntryPoint < EntryPointNames.Num(); ++EntryPoint)
+			{
+				FSummary Summary;
+				Summary.EntryPoint = EntryPoint;
+
+				for (const auto& ThreadStats : AllThreadStats)
+				{
+					const auto& Stats = ThreadStats->EntryPoints[EntryPoint];
+
+					Summary.CallCount   += Stats.CallCount.load(std::memory_order_relaxed);
+					Summary.TotalCycles += Stats.TotalCycles.load(std::memory_order_relaxed);
+					Summary.MaxCycles    = std::max(Summary.MaxCycles, Stats.MaxCycles.load(std::memory_order_relaxed));
+
+					for (uint32 ErrorCode = 0; ErrorCode <= MaxTrackedErrorCode; ++ErrorCode)
+					{
+						Summary.ErrorCodeCounts[ErrorCode] += Stats.ErrorCodeCounts[ErrorCode].load(std::memory_order_relaxed);
+					}
+				}
+
+				if (Summary.CallCount > 0)
+				{
+					Summaries.Add(Summary);
+				}
+			}
+
+			Summaries.Sort([](const FSummary& Lhs, const FSummary& Rhs) { return Lhs.TotalCycles > Rhs.TotalCycles; });
+
+			const auto CyclesToMs = [](const uint64 Cycles) { return FPlatformTime::ToMilliseconds64(Cycles); };
+
+			FString Result = FString::Printf(TEXT("%-36s %10s %12s %10s %10s  %s\n"),
+			                                 TEXT("Entry point"), TEXT("Calls"), TEXT("Total (ms)"), TEXT("Mean (us)"), TEXT("Max (us)"), TEXT("Errors"));
+
+			for (const auto& Summary : Summaries)
+			{
+				FString Errors;
+				for (uint32 ErrorCode = 1; ErrorCode <= MaxTrackedErrorCode; ++ErrorCode)
+				{
+					if (Summary.ErrorCodeCounts[ErrorCode] == 0)
+					{
+						continue;
+					}
+
+					const auto ErrorName = ErrorCode == MaxTrackedErrorCode
+						                       ? FString(TEXT("Other"))
+						                       : Deltacast::Helpers::GetErrorString(static_cast<VHD_ERRORCODE>(ErrorCode));
+
+					Errors += FString::Printf(TEXT("%s%s x%llu"), Errors.IsEmpty() ? TEXT("") : TEXT(", "), *ErrorName, Summary.ErrorCodeCounts[ErrorCode]);
+				}
+
+				Result += FString::Printf(TEXT("%-36s %10llu %12.3f %10.1f %10.1f  %s\n"),
+				                          *EntryPointNames[Summary.EntryPoint],
+				                          Summary.CallCount,
+				                          CyclesToMs(Summary.TotalCycles),
+				                          CyclesToMs(Summary.TotalCycles) * 1000.0 / static_cast<double>(Summary.CallCount),
+				                          CyclesToMs(Summary.MaxCycles) * 1000.0,
+				                          Errors.IsEmpty() ? TEXT("-") : *Errors);
+			}
+
+			return Result;
+		}
+
+		void ResetStats()
+		{
+			FScopeLock Lock(&CriticalSection);
+
+			for (const auto& ThreadStats : AllThreadStats)
+			{
+				for (auto& Stats : ThreadStats->EntryPoints)
+				{
+					Stats.CallCount.store(0, std::memory_order_relaxed);
+					Stats.TotalCycles.store(0, std::memory_order_relaxed);
+					Stats.MaxCycles.store(0, std::memory_order_relaxed);
+
+					for (auto& ErrorCodeCount : Stats.ErrorCodeCounts)
+					{
+						ErrorCodeCount.store(0, std::memory_order_relaxed);
+					}
+				}
+			}
+		}
+
+	private:
+		FCriticalSection CriticalSection;
+
+		TArray<FString> EntryPointNames;
+
+		TArray<TUniquePtr<FThreadStats>> AllThreadStats;
+	};
+
+	static FTraceRegistry& GetTraceRegistry()
+	{
+		static FTraceRegistry TraceRegistry;
+
+		return TraceRegistry;
+	}
+
+
+	/** Gives the counters back to the registry when the thread exits */
+	struct FThreadStatsHandle
+	{
+		~FThreadStatsHandle()
+		{
+			if (ThreadStats != nullptr)
+			{
+				ThreadStats->bInUse = false;
+			}
+		}
+
+		FThreadStats* ThreadStats = nullptr;
+	};
+
+	static thread_local FThreadStatsHandle ThreadStatsHandle;
+
+
+
+	int32 RegisterEntryPoint(const TCHAR* Name)
+	{
+		return GetTraceRegistry().RegisterEntryPoint(Name);
+	}
+
+	bool IsEnabled()
+	{
+		return bTraceEnabled;
+	}
+
+	void RecordCall(const int32 EntryPoint, const uint64 Cycles, const bool bHasResult, const VHD::ULONG Result)
+	{
+		if (EntryPoint == INDEX_NONE)
+		{
+			return;
+		}
+
+		if (ThreadStatsHandle.ThreadStats == nullptr)
+		{
+			ThreadStatsHandle.ThreadStats = GetTraceRegistry().AcquireThreadStats();
+		}
+
+		auto& Stats = ThreadStatsHandle.ThreadStats->EntryPoints[EntryPoint];
+
+		// Only this thread writes these counters, relaxed read-modify-write is enough
+		Stats.CallCount.store(Stats.CallCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		Stats.TotalCycles.store(Stats.TotalCycles.load(std::memory_order_relaxed) + Cycles, std::memory_order_relaxed);
+
+		if (Cycles > Stats.MaxCycles.load(std::memory_order_relaxed))
+		{
+			Stats.MaxCycles.store(Cycles, std::memory_order_relaxed);
+		}
+
+		if (bHasResult)
+		{
+			auto& ErrorCodeCount = Stats.ErrorCodeCounts[std::min<VHD::ULONG>(Result, MaxTrackedErrorCode)];
+			ErrorCodeCount.store(ErrorCodeCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+	}
+
+	FString GetStatsString()
+	{
+		return GetTraceRegistry().GetStatsString();
+	}
+
+	void ResetStats()
+	{
+		GetTraceRegistry().ResetStats();
+	}
+
+
+	static FAutoConsoleCommand DeltacastSdkDumpStatsCmd(
+		TEXT("Deltacast.Sdk.DumpStats"),
+		TEXT("Log the call count, latency and error codes of each Deltacast SDK entry point recorded while Deltacast.Sdk.Trace is enabled."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			if (!IsEnabled())
+			{
+				UE_LOG(LogDeltacastMedia, Display, TEXT("Deltacast SDK tracing is disabled, enable it with Deltacast.Sdk.Trace 1"));
+			}
+
+			UE_LOG(LogDeltacastMedia, Display, TEXT("Deltacast SDK statistics:\n%s"), *GetStatsString());
+		}));
+
+	static FAutoConsoleCommand DeltacastSdkResetStatsCmd(
+		TEXT("Deltacast.Sdk.ResetStats"),
+		TEXT("Reset the Deltacast SDK statistics."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			ResetStats();
+		}));
+}
@@ -0,0 +1,94 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "DeltacastDefinition.h"
+
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+
+
+/**
+ * Optional per-entry-point statistics of the SDK calls, enabled with `Deltacast.Sdk.Trace 1` and logged with `Deltacast.Sdk.DumpStats`.
+ * Each thread records into its own counters, they are only summed when dumped.
+ */
+namespace Deltacast::SdkTrace
+{
+	inline static constexpr int32 MaxEntryPoints = 64;
+
+	/** Error codes at or above this value are counted together */
+	inline static constexpr uint32 MaxTrackedErrorCode = 63;
+
+	/** Index of the entry point with this name, registered on first call */
+	[[nodiscard]] DELTACASTMEDIA_API int32 RegisterEntryPoint(const TCHAR* Name);
+
+	[[nodiscard]] DELTACASTMEDIA_API bool IsEnabled();
+
+	DELTACASTMEDIA_API void RecordCall(int32 EntryPoint, uint64 Cycles, bool bHasResult, VHD::ULONG Result);
+
+	[[nodiscard]] DELTACASTMEDIA_API FString GetStatsString();
+	DELTACASTMEDIA_API void ResetStats();
+
+
+	/** Measures an SDK call, the result is only recorded when it is passed through `Record` */
+	class FScope final
+	{
+	public:
+		explicit FScope(const int32 InEntryPoint)
+			: EntryPoint(InEntryPoint),
+			  StartCycles(IsEnabled() ? FPlatformTime::Cycles64() : 0)
+		{
+		}
+
+		~FScope()
+		{
+			if (StartCycles != 0)
+			{
+				RecordCall(EntryPoint, FPlatformTime::Cycles64() - StartCycles, bHasResult, Result);
+			}
+		}
+
+		FScope(const FScope &Other)     = delete;
+		FScope(FScope &&Other) noexcept = delete;
+
+		FScope &operator=(const FScope &Other)     = delete;
+		FScope &operator=(FScope &&Other) noexcept = delete;
+
+	public:
+		[[nodiscard]] VHD_ERRORCODE Record(const VHD::ULONG InResult)
+		{
+			bHasResult = true;
+			Result     = InResult;
+
+			return static_cast<VHD_ERRORCODE>(InResult);
+		}
+
+	private:
+		const int32  EntryPoint;
+		const uint64 StartCycles;
+
+		bool       bHasResult = false;
+		VHD::ULONG Result     = 0;
+	};
+}
+
+
+/** Times the enclosing SDK wrapper, the SDK result is recorded by returning `TraceScope.Record(Wrapper_...(...))` */
+#define DELTACAST_SDK_TRACE_SCOPE(EntryPointName) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_STR("Deltacast::" #EntryPointName); \
+	static const int32 TraceEntryPoint = Deltacast::SdkTrace::RegisterEntryPoint(TEXT(#EntryPointName)); \
+	Deltacast::SdkTrace::FScope TraceScope(TraceEntryPoint)
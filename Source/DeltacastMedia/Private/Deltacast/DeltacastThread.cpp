@@ -0,0 +1,201 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastThread.h"
+
+#include "DeltacastMediaSettings.h"
+#include "IDeltacastMediaModule.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/FileHelper.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <Windows.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_LINUX
+#include <cerrno>
+#include <cstring>
+#include <sched.h>
+#endif
+
+
+
+namespace Deltacast::Thread
+{
+	static EThreadPriority ToThreadPriority(const EDeltacastThreadPriority Priority)
+	{
+		switch (Priority)
+		{
+			case EDeltacastThreadPriority::AboveNormal: return TPri_AboveNormal;
+			case EDeltacastThreadPriority::Highest: return TPri_Highest;
+			case EDeltacastThreadPriority::TimeCritical: return TPri_TimeCritical;
+			case EDeltacastThreadPriority::Normal:
+			default:
+				return TPri_Normal;
+		}
+	}
+
+	static std::optional<FThreadAffinity> GetAffinity(const TCHAR* ThreadName, const FDeltacastThreadSettings& Settings, const int32 BoardIndex)
+	{
+		std::optional<FThreadAffinity> Affinity;
+
+		if (Settings.AffinityMask != 0)
+		{
+			Affinity = FThreadAffinity{ static_cast<uint64>(Settings.AffinityMask), 0 };
+		}
+
+		if (!Settings.bPinToBoardNumaNode)
+		{
+			return Affinity;
+		}
+
+		const auto BoardSettings = GetDefault<UDeltacastMediaSettings>()->GetBoardSettings(BoardIndex);
+		if (BoardSettings == nullptr || BoardSettings->NumaNode < 0)
+		{
+			UE_LOG(LogDeltacastMedia, Warning, TEXT("%s: no NUMA node set for board %d, the thread is not pinned to a NUMA node"), ThreadName, BoardIndex);
+			return Affinity;
+		}
+
+		const auto NodeAffinity = GetNumaNodeAffinity(BoardSettings->NumaNode);
+		if (!NodeAffinity.has_value())
+		{
+			UE_LOG(LogDeltacastMedia, Warning, TEXT("%s: cannot get the cores of NUMA node %d, the thread is not pinned to a NUMA node"),
+			       ThreadName, BoardSettings->NumaNode);
+			return Affinity;
+		}
+
+		if (!Affinity.has_value())
+		{
+			return NodeAffinity;
+		}
+
+		const auto CommonMask = Affinity->ThreadAffinityMask & NodeAffinity->ThreadAffinityMask;
+		if (NodeAffinity->ProcessorGroup != 0 || CommonMask == 0)
+		{
+			UE_LOG(LogDeltacastMedia, Warning, TEXT("%s: the affinity mask %llx has no core on NUMA node %d, using the NUMA node cores"),
+			       ThreadName, Affinity->ThreadAffinityMask, BoardSettings->NumaNode);
+			return NodeAffinity;
+		}
+
+		return FThreadAffinity{ CommonMask, 0 };
+	}
+
+	static void SetRealTimeScheduling(FRunnableThread& Thread, const FDeltacastThreadSettings& Settings)
+	{
+		if (!Settings.bUseRealTimeScheduling)
+		{
+			return;
+		}
+
+#if PLATFORM_LINUX
+		sched_param Parameters{};
+		Parameters.sched_priority = FMath::Clamp(Settings.RealTimePriority, sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+
+		if (sched_setscheduler(static_cast<pid_t>(Thread.GetThreadID()), SCHED_FIFO, &Parameters) != 0)
+		{
+			const auto Error = errno;
+			UE_LOG(LogDeltacastMedia, Warning, TEXT("%s: cannot use SCHED_FIFO (%s), the process needs CAP_SYS_NICE or a RLIMIT_RTPRIO of at least %d"),
+			       *Thread.GetThreadName(), UTF8_TO_TCHAR(strerror(Error)), Parameters.sched_priority);
+			return;
+		}
+
+		UE_LOG(LogDeltacastMedia, Log, TEXT("%s: SCHED_FIFO priority %d"), *Thread.GetThreadName(), Parameters.sched_priority);
+#else
+		UE_LOG(LogDeltacastMedia, Warning, TEXT("%s: real-time scheduling is only available on Linux"), *Thread.GetThreadName());
+#endif
+	}
+
+
+	FRunnableThread* Create(FRunnable* Runnable, const TCHAR* ThreadName, const FDeltacastThreadSettings& Settings, const int32 BoardIndex)
+	{
+		const auto Priority = ToThreadPriority(Settings.Priority);
+		const auto Affinity = GetAffinity(ThreadName, Settings, BoardIndex);
+
+		const auto Thread = FRunnableThread::Create(Runnable, ThreadName, 0, Priority,
+		                                            Affinity.has_value() ? Affinity->ThreadAffinityMask : FPlatformAffinity::GetNoAffinityMask());
+		if (Thread == nullptr)
+		{
+			return nullptr;
+		}
+
+		if (Affinity.has_value() && Affinity->ProcessorGroup != 0)
+		{
+			Thread->SetThreadAffinity(Affinity.value());
+		}
+
+		SetRealTimeScheduling(*Thread, Settings);
+
+		UE_LOG(LogDeltacastMedia, Log, TEXT("%s: priority %s, affinity %s"), ThreadName, *UEnum::GetDisplayValueAsText(Settings.Priority).ToString(),
+		       Affinity.has_value() ? *FString::Printf(TEXT("%llx (group %u)"), Affinity->ThreadAffinityMask, Affinity->ProcessorGroup) : TEXT("any core"));
+
+		return Thread;
+	}
+
+	std::optional<FThreadAffinity> GetNumaNodeAffinity(const int32 NumaNode)
+	{
+		if (NumaNode < 0)
+		{
+			return {};
+		}
+
+#if PLATFORM_WINDOWS
+		GROUP_AFFINITY GroupAffinity{};
+		if (!GetNumaNodeProcessorMaskEx(static_cast<USHORT>(NumaNode), &GroupAffinity) || GroupAffinity.Mask == 0)
+		{
+			return {};
+		}
+
+		return FThreadAffinity{ static_cast<uint64>(GroupAffinity.Mask), GroupAffinity.Group };
+#elif PLATFORM_LINUX
+		// Comma separated ranges of cores, "0-15,32-47"
+		FString CpuList;
+		if (!FFileHelper::LoadFileToString(CpuList, *FString::Printf(TEXT("/sys/devices/system/node/node%d/cpulist"), NumaNode)))
+		{
+			return {};
+		}
+
+		TArray<FString> Ranges;
+		CpuList.TrimStartAndEnd().ParseIntoArray(Ranges, TEXT(","));
+
+		uint64 Mask = 0;
+		for (const auto& Range : Ranges)
+		{
+			FString First;
+			FString Last;
+			if (!Range.Split(TEXT("-"), &First, &Last))
+			{
+				First = Last = Range;
+			}
+
+			// The affinity mask covers the first 64 cores
+			const auto FirstCore = FMath::Clamp(FCString::Atoi(*First), 0, 64);
+			const auto LastCore  = FMath::Clamp(FCString::Atoi(*Last), 0, 63);
+			for (auto Core = FirstCore; Core <= LastCore; ++Core)
+			{
+				Mask |= uint64{ 1 } << Core;
+			}
+		}
+
+		if (Mask == 0)
+		{
+			return {};
+		}
+
+		return FThreadAffinity{ Mask, 0 };
+#else
+		return {};
+#endif
+	}
+}
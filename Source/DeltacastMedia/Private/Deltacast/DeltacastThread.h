@@ -0,0 +1,40 @@
+﻿/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "GenericPlatform/GenericPlatformAffinity.h"
+
+#include <optional>
+
+
+
+class FRunnable;
+class FRunnableThread;
+struct FDeltacastThreadSettings;
+
+
+
+namespace Deltacast::Thread
+{
+	/**
+	 * Creates the thread with the priority, affinity and scheduling policy of its settings, nullptr on failure.
+	 * The board index selects the NUMA node when the thread is pinned to the board NUMA node.
+	 */
+	[[nodiscard]] DELTACASTMEDIA_API FRunnableThread* Create(FRunnable* Runnable, const TCHAR* ThreadName, const FDeltacastThreadSettings& Settings, int32 BoardIndex);
+
+	/** Cores of the NUMA node, empty when the node is unknown to the platform */
+	[[nodiscard]] DELTACASTMEDIA_API std::optional<FThreadAffinity> GetNumaNodeAffinity(int32 NumaNode);
+}
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastDeviceMonitor.h"
+
+#include "DeltacastHelpers.h"
+#include "DeltacastSdk.h"
+#include "IDeltacastMediaModule.h"
+#include "HAL/PlatformProcess.h"
+
+
+
+FDeltacastDeviceMonitor::FDeltacastDeviceMonitor(TFunction<void()> InOnDevicesChanged)
+	: OnDevicesChanged(MoveTemp(InOnDevicesChanged)),
+	  WakeUpEvent(FPlatformProcess::GetSynchEventFromPool(false))
+{
+	check(OnDevicesChanged);
+}
+
+FDeltacastDeviceMonitor::~FDeltacastDeviceMonitor()
+{
+	FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+	WakeUpEvent = nullptr;
+}
+
+
+bool FDeltacastDeviceMonitor::Init()
+{
+	if (WakeUpEvent == nullptr)
+	{
+		UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to create device monitor event"));
+		return false;
+	}
+
+	LastBoardCount = FDeltacast::GetSdk().GetNbBoards();
+
+	return true;
+}
+
+uint32 FDeltacastDeviceMonitor::Run()
+{
+	OnDevicesChanged();
+
+	while (!bStopRequested)
+	{
+		WakeUpEvent->Wait(Deltacast::Helpers::DeviceMonitorPeriodMs);
+
+		if (bStopRequested)
+		{
+			break;
+		}
+
+		const auto BoardCount = FDeltacast::GetSdk().GetNbBoards();
+		const auto bBoardCountChanged = BoardCount != LastBoardCount;
+
+		if (bBoardCountChanged)
+		{
+			UE_LOG(LogDeltacastMedia, Display, TEXT("Deltacast board count changed from %u to %u"),
+			       LastBoardCount.value_or(0), BoardCount.value_or(0));
+			LastBoardCount = BoardCount;
+		}
+
+		if (bBoardCountChanged || bRefreshRequested.exchange(false))
+		{
+			OnDevicesChanged();
+		}
+	}
+
+	return 0;
+}
+
+void FDeltacastDeviceMonitor::Stop()
+{
+	bStopRequested = true;
+
+	if (WakeUpEvent != nullptr)
+	{
+		WakeUpEvent->Trigger();
+	}
+}
+
+
+void FDeltacastDeviceMonitor::RequestRefresh()
+{
+	bRefreshRequested = true;
+
+	if (WakeUpEvent != nullptr)
+	{
+		WakeUpEvent->Trigger();
+	}
+}
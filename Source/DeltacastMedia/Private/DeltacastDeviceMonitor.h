@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "HAL/Event.h"
+#include "HAL/Runnable.h"
+#include "Templates/Function.h"
+
+#include <atomic>
+#include <optional>
+
+
+
+/**
+ * Polls the number of boards in the background and notifies when it changes (hot-plug) or when a refresh is requested.
+ * It also notifies once when started so the initial enumeration does not run on the thread starting the monitor.
+ */
+class FDeltacastDeviceMonitor final : public FRunnable
+{
+public:
+	explicit FDeltacastDeviceMonitor(TFunction<void()> InOnDevicesChanged);
+	virtual ~FDeltacastDeviceMonitor() override;
+
+public: //~ FRunnable
+	virtual bool   Init() override;
+	virtual uint32 Run() override;
+
+	virtual void Stop() override;
+
+public:
+	/** Notify on the next poll even if the board count did not change */
+	void RequestRefresh();
+
+private:
+	TFunction<void()> OnDevicesChanged;
+
+	std::optional<uint32> LastBoardCount;
+
+	std::atomic<bool> bStopRequested    = false;
+	std::atomic<bool> bRefreshRequested = false;
+
+	FEvent *WakeUpEvent = nullptr;
+};
@@ -15,10 +15,21 @@
 
 #include "DeltacastDeviceProvider.h"
 
+#include "DeltacastBoardRegistry.h"
+#include "DeltacastDeviceMonitor.h"
 #include "DeltacastDeviceScanner.h"
 #include "DeltacastHelpers.h"
 #include "DeltacastSdk.h"
 #include "IDeltacastMediaModule.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/RunnableThread.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
 DECLARE_CYCLE_STAT(TEXT("GetConfigurations"), STAT_DeltacastDeviceConfigurations, STATGROUP_Deltacast);
 
@@ -107,6 +118,58 @@ namespace DeltacastDeviceProvider
 
 		return MediaMode;
 	}
+
+
+	static constexpr uint32 PersistentCacheMagic         = 0x44434443; // "DCDC"
+	static constexpr uint32 PersistentCacheFormatVersion = 1;
+
+	FString GetPersistentCachePath()
+	{
+		return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Deltacast"), TEXT("DeviceCache.bin"));
+	}
+
+	FString GetPluginVersion()
+	{
+		const auto Plugin = IPluginManager::Get().FindPlugin(TEXT("DeltacastMedia"));
+		return Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString();
+	}
+
+	VHD::ULONG GetApiVersion()
+	{
+		VHD::ULONG ApiVersion = 0;
+		[[maybe_unused]] const auto Result = FDeltacast::GetSdk().GetApiInfo(&ApiVersion, nullptr);
+		return ApiVersion;
+	}
+
+	template <typename T>
+	void SerializeStructArray(FArchive& Ar, TArray<T>& Array)
+	{
+		int32 Num = Array.Num();
+		Ar << Num;
+
+		if (Ar.IsLoading())
+		{
+			// Every element takes at least one byte, a larger count comes from a corrupt file
+			if (Num < 0 || Num > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				return;
+			}
+
+			Array.SetNum(Num);
+		}
+
+		for (auto& Item : Array)
+		{
+			T::StaticStruct()->SerializeItem(Ar, &Item, nullptr);
+		}
+	}
+}
+
+
+static FArchive& operator<<(FArchive& Ar, FDeltacastBoardCapabilities& Capabilities)
+{
+	return Ar << Capabilities.SdiInterfaces << Capabilities.SdiVideoStandards;
 }
 
 
@@ -131,22 +194,15 @@ bool FDeltacastDeviceProvider::CanDeviceDoAlpha(const FMediaIODevice &InDevice)
 		return false;
 	}
 
-	auto& DeltacastSdk = FDeltacast::GetSdk();
-
 	const auto BoardIndex = InDevice.DeviceIdentifier;
-	const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-	if (BoardHandle == VHD::InvalidHandle)
+	const auto BoardInfo = FDeltacast::GetBoardRegistry().GetBoardInfo(BoardIndex);
+	if (!BoardInfo.has_value())
 	{
 		UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to open board index %d"), BoardIndex);
 		return false;
 	}
 
-	Deltacast::Helpers::TScopeExit CloseBoardHandle([&]() { DeltacastSdk.CloseBoardHandle(BoardHandle); });
-
-	const auto IsYuvkSupported = DeltacastSdk.GetBoardCapBufferPacking(BoardHandle, VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUVK4224_8);
-	const auto TxCount = DeltacastSdk.GetTxCount(BoardHandle);
-
-	if (TxCount.value_or(0) < 2 || !IsYuvkSupported.value_or(false))
+	if (BoardInfo->TxCount < 2 || !BoardInfo->bIsYuvk8Supported)
 		return false;
 	
 	return true;
@@ -167,9 +223,7 @@ TArray<FMediaIOConnection> FDeltacastDeviceProvider::GetConnections() const
 		return {};
 	}
 
-	UpdateCache();
-
-	return ConnectionsCache;
+	return GetCache()->Connections;
 }
 
 TArray<FMediaIOConfiguration> FDeltacastDeviceProvider::GetConfigurations() const
@@ -184,18 +238,18 @@ TArray<FMediaIOConfiguration> FDeltacastDeviceProvider::GetConfigurations(const
 		return {};
 	}
 
-	UpdateCache();
+	const auto CurrentCache = GetCache();
 
 	TArray<FMediaIOConfiguration> Results;
 
 	if (bAllowInput)
 	{
-		Results.Append(ConfigurationsInputCache);
+		Results.Append(CurrentCache->ConfigurationsInput);
 	}
 
 	if (bAllowOutput)
 	{
-		Results.Append(ConfigurationsOutputCache);
+		Results.Append(CurrentCache->ConfigurationsOutput);
 	}
 
 	return Results;
@@ -208,9 +262,7 @@ TArray<FMediaIOInputConfiguration> FDeltacastDeviceProvider::GetInputConfigurati
 		return {};
 	}
 
-	UpdateCache();
-
-	return InputConfigurationsCache;
+	return GetCache()->InputConfigurations;
 }
 
 TArray<FMediaIOOutputConfiguration> FDeltacastDeviceProvider::GetOutputConfigurations() const
@@ -220,9 +272,7 @@ TArray<FMediaIOOutputConfiguration> FDeltacastDeviceProvider::GetOutputConfigura
 		return {};
 	}
 
-	UpdateCache();
-
-	return OutputConfigurationsCache;
+	return GetCache()->OutputConfigurations;
 }
 
 TArray<FMediaIOVideoTimecodeConfiguration> FDeltacastDeviceProvider::GetTimecodeConfigurations() const
@@ -232,9 +282,7 @@ TArray<FMediaIOVideoTimecodeConfiguration> FDeltacastDeviceProvider::GetTimecode
 		return {};
 	}
 
-	UpdateCache();
-
-	return TimecodeConfigurationsCache;
+	return GetCache()->TimecodeConfigurations;
 }
 
 TArray<FMediaIODevice> FDeltacastDeviceProvider::GetDevices() const
@@ -244,9 +292,7 @@ TArray<FMediaIODevice> FDeltacastDeviceProvider::GetDevices() const
 		return {};
 	}
 
-	UpdateCache();
-
-	return DevicesCache;
+	return GetCache()->Devices;
 }
 
 TArray<FMediaIOMode> FDeltacastDeviceProvider::GetModes(const FMediaIODevice &InDevice, const bool bInOutput) const
@@ -256,9 +302,9 @@ TArray<FMediaIOMode> FDeltacastDeviceProvider::GetModes(const FMediaIODevice &In
 		return {};
 	}
 
-	UpdateCache();
+	const auto CurrentCache = GetCache();
 
-	return bInOutput ? ModesInputCache : ModesOutputCache;
+	return bInOutput ? CurrentCache->ModesInput : CurrentCache->ModesOutput;
 }
 
 
@@ -332,231 +378,148 @@ TArray<FMediaIOConfiguration> FDeltacastDeviceProvider::GetOutputKeyConfiguratio
 		return {};
 	}
 
-	UpdateCache();
-
-	return ConfigurationsKeyOutputCache;
+	return GetCache()->ConfigurationsKeyOutput;
 }
 
 
 
-TArray<FMediaIOConnection> FDeltacastDeviceProvider::GetConnections_Impl() const
+TArray<FMediaIOConnection> FDeltacastDeviceProvider::GetConnections_Impl(const FDeltacastBoard& Board) const
 {
 	TArray<FMediaIOConnection> Results;
 
-	if (!FDeltacast::IsInitialized())
-	{
-		return Results;
-	}
+	FMediaIOConnection MediaConnection;
 
-	auto& DeltacastSdk = FDeltacast::GetSdk();
+	MediaConnection.Device.DeviceIdentifier = static_cast<int32>(Board.GetInfo().BoardIndex);
+	MediaConnection.Device.DeviceName = FName(Board.GetInfo().Model);
+	MediaConnection.Protocol = GetProtocolName();
 
-	VHD::ULONG NbBoards = 0;
-	VHD::ULONG ApiVersion = 0;
-	const auto ApiInfoResult = DeltacastSdk.GetApiInfo(&ApiVersion, &NbBoards);
-	if (!Deltacast::Helpers::IsValid(ApiInfoResult))
+	for (VHD::ULONG RxPortIndex = 0; RxPortIndex < Board.GetInfo().RxCount; ++RxPortIndex)
 	{
-		return Results;
-	}
+		const auto ChannelType = Board.GetChannelType(true, RxPortIndex);
+		if (!ChannelType)
+			continue;
 
-	for (int32 BoardIndex = 0; BoardIndex < static_cast<int32>(NbBoards); ++BoardIndex)
-	{
-		const auto BoardModel = DeltacastSdk.GetBoardModel(BoardIndex);
-		if (BoardModel == nullptr)
+		MediaConnection.PortIdentifier = static_cast<int32>(RxPortIndex);
+
+		const auto bIsSdi = Deltacast::Helpers::IsSdi(ChannelType.value());
+		const auto bIsDv = Deltacast::Helpers::IsDv(ChannelType.value());
+
+		if (bIsSdi)
 		{
-			UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to get the board model for board index %u"), BoardIndex);
-			continue;
+			MediaConnection.TransportType = EMediaIOTransportType::SingleLink;
 		}
-
-		const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-		if (BoardHandle == VHD::InvalidHandle)
+		else if (bIsDv)
 		{
-			UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to open board index %d"), BoardIndex);
-			continue;
+			MediaConnection.TransportType = EMediaIOTransportType::HDMI;
 		}
-
-		Deltacast::Helpers::TScopeExit CloseBoardHandle([&]() {DeltacastSdk.CloseBoardHandle(BoardHandle); });
-
-		FMediaIOConnection MediaConnection;
-
-		MediaConnection.Device.DeviceIdentifier = BoardIndex;
-		MediaConnection.Device.DeviceName = FName(BoardModel);
-		MediaConnection.Protocol = GetProtocolName();
-
-		const auto NbRxChannels = DeltacastSdk.GetRxCount(BoardHandle);
-		if (!NbRxChannels.has_value())
+		else
 		{
-			UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to get board %d RX count"), BoardIndex);
 			continue;
 		}
 
-		for (VHD::ULONG RxPortIndex = 0; RxPortIndex < NbRxChannels.value(); ++RxPortIndex)
-		{
-			const auto ChannelType = DeltacastSdk.GetChannelType(BoardHandle, true, RxPortIndex);
-			if (!ChannelType)
-				continue;
-
-			MediaConnection.PortIdentifier = static_cast<int32>(RxPortIndex);
-
-			const auto bIsSdi = Deltacast::Helpers::IsSdi(ChannelType.value());
-			const auto bIsDv = Deltacast::Helpers::IsDv(ChannelType.value());
-
-			if (bIsSdi)
-			{
-				MediaConnection.TransportType = EMediaIOTransportType::SingleLink;
-			}
-			else if (bIsDv)
-			{
-				MediaConnection.TransportType = EMediaIOTransportType::HDMI;
-			}
-			else
-			{
-				continue;
-			}
-
-			Results.Add(MediaConnection);
-		}
+		Results.Add(MediaConnection);
 	}
 
 	return Results;
 }
 
-TTuple<TArray<FMediaIOConfiguration>, TArray<FMediaIOConfiguration>> FDeltacastDeviceProvider::GetConfigurations_Impl(const bool bAllowInput, const bool bAllowOutput) const
+void FDeltacastDeviceProvider::GetConfigurations_Impl(const FDeltacastBoard& Board, FBoardScan& Scan) const
 {
-	TArray<FMediaIOConfiguration> Results;
-	TArray<FMediaIOConfiguration> KeyResults;
+	const auto BoardIndex = Board.GetInfo().BoardIndex;
 
-	if (!FDeltacast::IsInitialized())
-	{
-		return TTuple<TArray<FMediaIOConfiguration>, TArray<FMediaIOConfiguration>>(Results, KeyResults);
-	}
+	FMediaIOConfiguration MediaConfiguration;
+	MediaConfiguration.MediaConnection.Device.DeviceIdentifier = static_cast<int32>(BoardIndex);
+	MediaConfiguration.MediaConnection.Device.DeviceName = FName(Board.GetInfo().Model);
+	MediaConfiguration.MediaConnection.Protocol = GetProtocolName();
 
-	auto& DeltacastSdk = FDeltacast::GetSdk();
+	const auto IsDualSupported = CanDeviceDoAlpha(MediaConfiguration.MediaConnection.Device);
 
-	const auto NumberOfBoards = DeltacastSdk.GetNbBoards();
-	if (!NumberOfBoards)
+	auto DeviceScanner = Deltacast::Device::FDeviceScanner::GetDeviceScanner(BoardIndex);
+	if (!DeviceScanner)
 	{
-		return TTuple<TArray<FMediaIOConfiguration>, TArray<FMediaIOConfiguration>>(Results, KeyResults);
+		return;
 	}
 
-	for (VHD::ULONG BoardIndex = 0; BoardIndex < NumberOfBoards.value(); ++BoardIndex)
-	{
-		FMediaIOConfiguration MediaConfiguration;
-		MediaConfiguration.MediaConnection.Device.DeviceIdentifier = BoardIndex;
-		MediaConfiguration.MediaConnection.Protocol = GetProtocolName();
-
-		const auto IsDualSupported = CanDeviceDoAlpha(MediaConfiguration.MediaConnection.Device);
-
-		const auto BoardModel = DeltacastSdk.GetBoardModel(BoardIndex);
-		if (BoardModel == nullptr)
-		{
-			UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to get the board model for board index %u"), BoardIndex);
-			continue;
-		}
-
-		const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-		if (!BoardHandle)
-		{
-			continue;
-		}
-
-		Deltacast::Helpers::TScopeExit CloseBoardHandle([&]() {DeltacastSdk.CloseBoardHandle(BoardHandle); });
+	auto SdiDeviceScanner = DeviceScanner.value().GetSdiDeviceScanner();
 
-		MediaConfiguration.MediaConnection.Device.DeviceName = FName(BoardModel);
-
-		auto DeviceScanner = Deltacast::Device::FDeviceScanner::GetDeviceScanner(BoardIndex);
-		if (!DeviceScanner)
-		{
-			continue;
-		}
-
-		auto SdiDeviceScanner = DeviceScanner.value().GetSdiDeviceScanner();
-
-		if (SdiDeviceScanner.has_value())
+	if (SdiDeviceScanner.has_value())
+	{
+		for (auto SdiDescriptor : SdiDeviceScanner.value())
 		{
-			for (auto SdiDescriptor : SdiDeviceScanner.value())
+			if (SdiDescriptor.Base.bIsInput && SdiDescriptor.IsDual())
 			{
-				if ((!bAllowInput && SdiDescriptor.Base.bIsInput) ||
-					(!bAllowOutput && !SdiDescriptor.Base.bIsInput))
-				{
-					continue;
-				}
+				continue;
+			}
 
-				if (!SdiDescriptor.IsValid(BoardHandle))
-				{
-					continue;
-				}
+			if (!SdiDescriptor.IsValid(Board))
+			{
+				continue;
+			}
 
-				MediaConfiguration.bIsInput = SdiDescriptor.Base.bIsInput;
-				MediaConfiguration.MediaConnection.PortIdentifier = static_cast<int32>(SdiDescriptor.Base.PortIndex);
+			MediaConfiguration.bIsInput = SdiDescriptor.Base.bIsInput;
+			MediaConfiguration.MediaConnection.PortIdentifier = static_cast<int32>(SdiDescriptor.Base.PortIndex);
 
-				if (SdiDescriptor.IsSingleLink())
-				{
-					MediaConfiguration.MediaConnection.TransportType = EMediaIOTransportType::SingleLink;
-					MediaConfiguration.MediaConnection.QuadTransportType = {};
-				}
-				else
+			if (SdiDescriptor.IsSingleLink())
+			{
+				MediaConfiguration.MediaConnection.TransportType = EMediaIOTransportType::SingleLink;
+				MediaConfiguration.MediaConnection.QuadTransportType = {};
+			}
+			else
+			{
+				MediaConfiguration.MediaConnection.TransportType = EMediaIOTransportType::QuadLink;
+				const auto QuadLinkType = SdiDescriptor.GetQuadLinkType();
+				switch (QuadLinkType)
 				{
-					MediaConfiguration.MediaConnection.TransportType = EMediaIOTransportType::QuadLink;
-					const auto QuadLinkType = SdiDescriptor.GetQuadLinkType();
-					switch (QuadLinkType)
-					{
-					case Deltacast::Helpers::EQuadLinkType::Quadrant:
-						MediaConfiguration.MediaConnection.QuadTransportType = EMediaIOQuadLinkTransportType::SquareDivision;
-						break;
-					case Deltacast::Helpers::EQuadLinkType::TwoSampleInterleaved:
-						MediaConfiguration.MediaConnection.QuadTransportType = EMediaIOQuadLinkTransportType::TwoSampleInterleave;
-						break;
-					default:
-						UE_LOG(LogDeltacastMedia, Fatal, TEXT("Unhandled QuadLinkType: %d"), QuadLinkType);
-						break;
-					}
+				case Deltacast::Helpers::EQuadLinkType::Quadrant:
+					MediaConfiguration.MediaConnection.QuadTransportType = EMediaIOQuadLinkTransportType::SquareDivision;
+					break;
+				case Deltacast::Helpers::EQuadLinkType::TwoSampleInterleaved:
+					MediaConfiguration.MediaConnection.QuadTransportType = EMediaIOQuadLinkTransportType::TwoSampleInterleave;
+					break;
+				default:
+					UE_LOG(LogDeltacastMedia, Fatal, TEXT("Unhandled QuadLinkType: %d"), QuadLinkType);
+					break;
 				}
+			}
 
-				MediaConfiguration.MediaMode = DeltacastDeviceProvider::ToMediaMode(SdiDescriptor);
+			MediaConfiguration.MediaMode = DeltacastDeviceProvider::ToMediaMode(SdiDescriptor);
 
-				if (SdiDescriptor.IsDual())
-				{
-					const auto IsDualSd = SdiDescriptor.Interface == VHD_INTERFACE::VHD_INTERFACE_SD_DUAL;
-					if (!SdiDescriptor.Base.bIsInput && IsDualSupported && !IsDualSd)
-						KeyResults.Add(MediaConfiguration);
-				}
-				else
-				{
-					Results.Add(MediaConfiguration);
-				}
+			if (SdiDescriptor.IsDual())
+			{
+				const auto IsDualSd = SdiDescriptor.Interface == VHD_INTERFACE::VHD_INTERFACE_SD_DUAL;
+				if (IsDualSupported && !IsDualSd)
+					Scan.ConfigurationsKeyOutput.Add(MediaConfiguration);
+			}
+			else
+			{
+				(SdiDescriptor.Base.bIsInput ? Scan.ConfigurationsInput : Scan.ConfigurationsOutput).Add(MediaConfiguration);
 			}
 		}
+	}
 
 
-		auto DvDeviceScanner = DeviceScanner.value().GetDvDeviceScanner();
+	auto DvDeviceScanner = DeviceScanner.value().GetDvDeviceScanner();
 
-		if (DvDeviceScanner.has_value())
+	if (DvDeviceScanner.has_value())
+	{
+		for (auto DvDescriptor : DvDeviceScanner.value())
 		{
-			for (auto DvDescriptor : DvDeviceScanner.value())
+			if (!DvDescriptor.IsValid(Board))
 			{
-				if ((!bAllowInput && DvDescriptor.Base.bIsInput) ||
-					(!bAllowOutput && !DvDescriptor.Base.bIsInput))
-				{
-					continue;
-				}
-
-				if (!DvDescriptor.IsValid(BoardHandle))
-				{
-					continue;
-				}
+				continue;
+			}
 
-				MediaConfiguration.bIsInput = DvDescriptor.Base.bIsInput;
-				MediaConfiguration.MediaConnection.PortIdentifier = static_cast<int32>(DvDescriptor.Base.PortIndex);
+			MediaConfiguration.bIsInput = DvDescriptor.Base.bIsInput;
+			MediaConfiguration.MediaConnection.PortIdentifier = static_cast<int32>(DvDescriptor.Base.PortIndex);
 
-				{
-					MediaConfiguration.MediaConnection.TransportType = EMediaIOTransportType::HDMI;
-					MediaConfiguration.MediaConnection.QuadTransportType = {};
-				}
+			{
+				MediaConfiguration.MediaConnection.TransportType = EMediaIOTransportType::HDMI;
+				MediaConfiguration.MediaConnection.QuadTransportType = {};
+			}
 
-				MediaConfiguration.MediaMode = DeltacastDeviceProvider::ToMediaMode(DvDescriptor);
+			MediaConfiguration.MediaMode = DeltacastDeviceProvider::ToMediaMode(DvDescriptor);
 
-				Results.Add(MediaConfiguration);
-			}
+			(DvDescriptor.Base.bIsInput ? Scan.ConfigurationsInput : Scan.ConfigurationsOutput).Add(MediaConfiguration);
 		}
 	}
 
@@ -593,7 +556,7 @@ TTuple<TArray<FMediaIOConfiguration>, TArray<FMediaIOConfiguration>> FDeltacastD
 		}
 	};
 
-	for (const auto& MediaConfiguration : Results)
+	for (const auto& MediaConfiguration : Scan.ConfigurationsOutput)
 	{
 		const auto& MediaMode = MediaConfiguration.MediaMode;
 		const auto& MediaConnection = MediaConfiguration.MediaConnection;
@@ -623,14 +586,11 @@ TTuple<TArray<FMediaIOConfiguration>, TArray<FMediaIOConfiguration>> FDeltacastD
 		//        QuadTransportTypeToString(MediaConnection.QuadTransportType));
 	}
 #endif
-
-	return TTuple<TArray<FMediaIOConfiguration>, TArray<FMediaIOConfiguration>>(Results, KeyResults);
 }
 
-TArray<FMediaIOInputConfiguration> FDeltacastDeviceProvider::GetInputConfigurations_Impl() const
+TArray<FMediaIOInputConfiguration> FDeltacastDeviceProvider::GetInputConfigurations_Impl(const TArray<FMediaIOConfiguration>& InputConfigurations) const
 {
 	TArray<FMediaIOInputConfiguration> Results;
-	TArray<FMediaIOConfiguration>      InputConfigurations = GetConfigurations(true, false);
 
 	FMediaIOInputConfiguration DefaultInputConfiguration = GetDefaultInputConfiguration();
 	Results.Reset(InputConfigurations.Num() * 2);
@@ -657,11 +617,10 @@ TArray<FMediaIOInputConfiguration> FDeltacastDeviceProvider::GetInputConfigurati
 	return Results;
 }
 
-TArray<FMediaIOOutputConfiguration> FDeltacastDeviceProvider::GetOutputConfigurations_Impl() const
+TArray<FMediaIOOutputConfiguration> FDeltacastDeviceProvider::GetOutputConfigurations_Impl(const TArray<FMediaIOConfiguration>& OutputConfigurations,
+                                                                                            const TArray<FMediaIOConfiguration>& OutputKeyConfigurations) const
 {
 	TArray<FMediaIOOutputConfiguration> Results;
-	TArray<FMediaIOConfiguration>       OutputConfigurations    = GetConfigurations(false, true);
-	TArray<FMediaIOConfiguration>       OutputKeyConfigurations = GetOutputKeyConfigurations();
 
 	FMediaIOOutputConfiguration DefaultOutputConfiguration = GetDefaultOutputConfiguration();
 	Results.Reset(OutputConfigurations.Num() + OutputKeyConfigurations.Num());
@@ -702,10 +661,8 @@ TArray<FMediaIOOutputConfiguration> FDeltacastDeviceProvider::GetOutputConfigura
 	return Results;
 }
 
-TArray<FMediaIOVideoTimecodeConfiguration> FDeltacastDeviceProvider::GetTimecodeConfigurations_Impl() const
+TArray<FMediaIOVideoTimecodeConfiguration> FDeltacastDeviceProvider::GetTimecodeConfigurations_Impl(const TArray<FMediaIOConfiguration>& InputConfigurations) const
 {
-	TArray<FMediaIOConfiguration> InputConfigurations = GetConfigurations(true, false);
-
 	TArray<FMediaIOVideoTimecodeConfiguration> MediaConfigurations;
 	MediaConfigurations.Reset(InputConfigurations.Num() * 2);
 
@@ -725,181 +682,397 @@ TArray<FMediaIOVideoTimecodeConfiguration> FDeltacastDeviceProvider::GetTimecode
 	return MediaConfigurations;
 }
 
-TArray<FMediaIODevice> FDeltacastDeviceProvider::GetDevices_Impl() const
+TArray<FMediaIOMode> FDeltacastDeviceProvider::GetModes_Impl(const FDeltacastBoard& Board, const bool bInOutput) const
+{
+	TArray<FMediaIOMode> Results;
+
+	const auto BoardIndex = Board.GetInfo().BoardIndex;
+
+	const auto NbPorts = bInOutput ? Board.GetInfo().RxCount : Board.GetInfo().TxCount;
+
+	{
+		auto SdiConfig = Deltacast::Device::Config::FSdiPortConfig{};
+		SdiConfig.Base.BoardIndex = BoardIndex;
+		SdiConfig.Base.bIsInput = bInOutput;
+
+		for (uint32 PortIndex = 0; PortIndex < NbPorts; ++PortIndex)
+		{
+			SdiConfig.Base.PortIndex = PortIndex;
+
+			for (int Clock = 0; Clock < 2; ++Clock)
+			{
+				SdiConfig.Base.bIsEuropeanClock = Clock == 0;
+				const auto& InterfaceToVideoStandards = SdiConfig.Base.bIsEuropeanClock
+					? Deltacast::Helpers::SdiInterfaceToVideoStandards
+					: Deltacast::Helpers::SdiInterfaceToVideoStandardsUsClock;
+
+				for (int i = 0; i < InterfaceToVideoStandards.size(); ++i)
+				{
+					const auto& VideoStandards = InterfaceToVideoStandards[i];
+
+					SdiConfig.Interface = Deltacast::Helpers::SdiInterfaces[i];
+					for (const auto VideoStandard : VideoStandards)
+					{
+						SdiConfig.VideoStandard = VideoStandard;
+
+						if (!SdiConfig.IsValid(Board))
+						{
+							continue;
+						}
+
+						const auto MediaMode = DeltacastDeviceProvider::ToMediaMode(SdiConfig);
+
+						Results.Add(MediaMode);
+					}
+				}
+			}
+		}
+	}
+
+	{
+		auto DvConfig = Deltacast::Device::Config::FDvPortConfig{};
+		DvConfig.Base.BoardIndex = BoardIndex;
+		DvConfig.Base.bIsInput = bInOutput;
+
+		for (uint32 PortIndex = 0; PortIndex < NbPorts; ++PortIndex)
+		{
+			DvConfig.Base.PortIndex = PortIndex;
+
+			for (int Clock = 0; Clock < 2; ++Clock)
+			{
+				DvConfig.Base.bIsEuropeanClock = Clock == 0;
+				const auto VideoStandards = DvConfig.Base.bIsEuropeanClock
+					? Deltacast::Helpers::DvVideoStandardsVector
+					: Deltacast::Helpers::DvVideoStandardsUsClockVector;
+
+				for (const auto VideoStandard : VideoStandards)
+				{
+					DvConfig.VideoStandard = VideoStandard;
+
+					if (!DvConfig.IsValid(Board))
+					{
+						continue;
+					}
+
+					const auto MediaMode = DeltacastDeviceProvider::ToMediaMode(DvConfig);
+
+					Results.Add(MediaMode);
+				}
+			}
+		}
+	}
+
+	return Results;
+}
+
+
+TArray<FDeltacastDeviceProvider::FBoardScan> FDeltacastDeviceProvider::ScanBoards() const
 {
-	TArray<FMediaIODevice> Results;
+	TArray<FBoardScan> Results;
 
 	if (!FDeltacast::IsInitialized())
 	{
 		return Results;
 	}
 
-	const auto& DeltacastSdk = FDeltacast::GetSdk();
-
-	VHD::ULONG NbBoards = 0;
-	VHD::ULONG ApiVersion = 0;
-	const auto ApiInfoResult = DeltacastSdk.GetApiInfo(&ApiVersion, &NbBoards);
-	if (!Deltacast::Helpers::IsValid(ApiInfoResult))
+	const auto NbBoards = FDeltacast::GetSdk().GetNbBoards();
+	if (!NbBoards)
 	{
 		UE_LOG(LogDeltacastMedia, Error, TEXT("Cannot get available board count"));
 		return Results;
 	}
 
-	for (VHD::ULONG BoardIndex = 0; BoardIndex < NbBoards; ++BoardIndex)
+	Results.SetNum(static_cast<int32>(NbBoards.value()));
+
+	// Each board is only touched by its own task, the results are merged afterward so the order does not depend on scheduling
+	ParallelFor(Results.Num(), [this, &Results](const int32 BoardIndex)
 	{
-		const auto BoardModel = DeltacastSdk.GetBoardModel(BoardIndex);
-		if (BoardModel == nullptr)
-		{
-			UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to get the board model for board index %u"), BoardIndex);
-			continue;
-		}
+		Results[BoardIndex] = ScanBoard(static_cast<uint32>(BoardIndex));
+	});
+
+	return Results;
+}
 
+FDeltacastDeviceProvider::FBoardScan FDeltacastDeviceProvider::ScanBoard(const uint32 BoardIndex) const
+{
+	FBoardScan Scan;
+
+	const auto BoardModel = FDeltacast::GetSdk().GetBoardModel(BoardIndex);
+	if (BoardModel != nullptr)
+	{
 		FMediaIODevice Device;
 
 		Device.DeviceIdentifier = static_cast<int32>(BoardIndex);
 		Device.DeviceName = BoardModel;
 
-		Results.Add(Device);
+		Scan.Devices.Add(Device);
+	}
+	else
+	{
+		UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to get the board model for board index %u"), BoardIndex);
+	}
+
+	const auto Board = FDeltacast::GetBoardRegistry().Acquire(BoardIndex);
+	if (!Board.IsValid())
+	{
+		UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to open board index %u"), BoardIndex);
+		return Scan;
 	}
 
-	return Results;
+	Scan.Connections = GetConnections_Impl(*Board);
+
+	GetConfigurations_Impl(*Board, Scan);
+
+	Scan.ModesInput  = GetModes_Impl(*Board, true);
+	Scan.ModesOutput = GetModes_Impl(*Board, false);
+
+	return Scan;
 }
 
-TArray<FMediaIOMode> FDeltacastDeviceProvider::GetModes_Impl(const bool bInOutput) const
+
+FDeltacastDeviceProvider::FDeltacastDeviceProvider() = default;
+
+FDeltacastDeviceProvider::~FDeltacastDeviceProvider()
 {
-	TArray<FMediaIOMode> Results;
+	StopDeviceMonitor();
+}
 
-	if (!FDeltacast::IsInitialized())
+
+FDeltacastDeviceProvider::FDeviceCacheRef FDeltacastDeviceProvider::GetCache() const
+{
 	{
-		return Results;
+		FReadScopeLock Lock(CacheLock);
+
+		if (Cache.IsValid())
+		{
+			return Cache;
+		}
 	}
 
-	auto& DeltacastSdk = FDeltacast::GetSdk();
+	UE_LOG(LogDeltacastMedia, Verbose, TEXT("Deltacast device enumeration still in progress, waiting for it"));
 
-	const auto NbBoards = DeltacastSdk.GetNbBoards();
-	if (!NbBoards)
-	{
-		return Results;
-	}
+	UpdateCache();
+
+	FReadScopeLock Lock(CacheLock);
+	return Cache;
+}
+
+void FDeltacastDeviceProvider::UpdateCache() const
+{
+	FScopeLock Guard(&CacheUpdateCriticalSection);
+
+	auto HardwareIdentifier = ComputeCurrentHardwareIdentifier();
 
-	for (int32 BoardIndex = 0; BoardIndex < static_cast<int32>(NbBoards.value()); ++BoardIndex)
 	{
-		const auto BoardModel = DeltacastSdk.GetBoardModel(BoardIndex);
-		if (BoardModel == nullptr)
+		FReadScopeLock Lock(CacheLock);
+
+		if (Cache.IsValid() && Cache->HardwareIdentifier == HardwareIdentifier)
 		{
-			UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to get the board model for board index %u"), BoardIndex);
-			continue;
+			return;
 		}
+	}
 
-		const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-		if (BoardHandle == VHD::InvalidHandle)
+	if (const auto LoadedCache = LoadPersistentCache(HardwareIdentifier))
+	{
 		{
-			UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to open board index %d"), BoardIndex);
-			continue;
+			FWriteScopeLock Lock(CacheLock);
+
+			Cache = LoadedCache;
 		}
 
-		const auto NbPorts = bInOutput ? DeltacastSdk.GetRxCount(BoardHandle) : DeltacastSdk.GetTxCount(BoardHandle);
+		UE_LOG(LogDeltacastMedia, Log, TEXT("Deltacast device cache loaded from %s"), *DeltacastDeviceProvider::GetPersistentCachePath());
+		return;
+	}
 
-		{
-			auto SdiConfig = Deltacast::Device::Config::FSdiPortConfig{};
-			SdiConfig.Base.BoardIndex = BoardIndex;
-			SdiConfig.Base.bIsInput = bInOutput;
+	const auto NewCache = MakeShared<FDeviceCache, ESPMode::ThreadSafe>();
 
-			for (uint32 PortIndex = 0; PortIndex < NbPorts.value_or(0); ++PortIndex)
-			{
-				SdiConfig.Base.PortIndex = PortIndex;
+	NewCache->HardwareIdentifier = MoveTemp(HardwareIdentifier);
 
-				for (int Clock = 0; Clock < 2; ++Clock)
-				{
-					SdiConfig.Base.bIsEuropeanClock = Clock == 0;
-					const auto& InterfaceToVideoStandards = SdiConfig.Base.bIsEuropeanClock
-						? Deltacast::Helpers::SdiInterfaceToVideoStandards
-						: Deltacast::Helpers::SdiInterfaceToVideoStandardsUsClock;
+	for (auto& BoardScan : ScanBoards())
+	{
+		NewCache->Devices.Append(MoveTemp(BoardScan.Devices));
+		NewCache->Connections.Append(MoveTemp(BoardScan.Connections));
+		NewCache->ConfigurationsInput.Append(MoveTemp(BoardScan.ConfigurationsInput));
+		NewCache->ConfigurationsOutput.Append(MoveTemp(BoardScan.ConfigurationsOutput));
+		NewCache->ConfigurationsKeyOutput.Append(MoveTemp(BoardScan.ConfigurationsKeyOutput));
+		NewCache->ModesInput.Append(MoveTemp(BoardScan.ModesInput));
+		NewCache->ModesOutput.Append(MoveTemp(BoardScan.ModesOutput));
+	}
 
-					for (int i = 0; i < InterfaceToVideoStandards.size(); ++i)
-					{
-						const auto& VideoStandards = InterfaceToVideoStandards[i];
+	NewCache->InputConfigurations    = GetInputConfigurations_Impl(NewCache->ConfigurationsInput);
+	NewCache->OutputConfigurations   = GetOutputConfigurations_Impl(NewCache->ConfigurationsOutput, NewCache->ConfigurationsKeyOutput);
+	NewCache->TimecodeConfigurations = GetTimecodeConfigurations_Impl(NewCache->ConfigurationsInput);
 
-						SdiConfig.Interface = Deltacast::Helpers::SdiInterfaces[i];
-						for (const auto VideoStandard : VideoStandards)
-						{
-							SdiConfig.VideoStandard = VideoStandard;
+	{
+		FWriteScopeLock Lock(CacheLock);
 
-							if (!SdiConfig.IsValid(BoardHandle))
-							{
-								continue;
-							}
+		Cache = NewCache;
+	}
 
-							const auto MediaMode = DeltacastDeviceProvider::ToMediaMode(SdiConfig);
+	UE_LOG(LogDeltacastMedia, Log, TEXT("Deltacast device cache updated: %d board(s), %d input and %d output configuration(s)"),
+	       NewCache->Devices.Num(), NewCache->ConfigurationsInput.Num(), NewCache->ConfigurationsOutput.Num());
 
-							Results.Add(MediaMode);
-						}
-					}
-				}
-			}
-		}
+	SavePersistentCache(*NewCache);
+}
 
-		{
-			auto DvConfig = Deltacast::Device::Config::FDvPortConfig{};
-			DvConfig.Base.BoardIndex = BoardIndex;
-			DvConfig.Base.bIsInput = bInOutput;
 
-			for (uint32 PortIndex = 0; PortIndex < NbPorts.value_or(0); ++PortIndex)
-			{
-				DvConfig.Base.PortIndex = PortIndex;
+void FDeltacastDeviceProvider::FDeviceCache::Serialize(FArchive& Ar)
+{
+	using DeltacastDeviceProvider::SerializeStructArray;
+
+	Ar << HardwareIdentifier;
+
+	SerializeStructArray(Ar, Connections);
+	SerializeStructArray(Ar, ConfigurationsInput);
+	SerializeStructArray(Ar, ConfigurationsOutput);
+	SerializeStructArray(Ar, ConfigurationsKeyOutput);
+	SerializeStructArray(Ar, InputConfigurations);
+	SerializeStructArray(Ar, OutputConfigurations);
+	SerializeStructArray(Ar, TimecodeConfigurations);
+	SerializeStructArray(Ar, Devices);
+	SerializeStructArray(Ar, ModesInput);
+	SerializeStructArray(Ar, ModesOutput);
+}
 
-				for (int Clock = 0; Clock < 2; ++Clock)
-				{
-					DvConfig.Base.bIsEuropeanClock = Clock == 0;
-					const auto VideoStandards = DvConfig.Base.bIsEuropeanClock
-						? Deltacast::Helpers::DvVideoStandardsVector
-						: Deltacast::Helpers::DvVideoStandardsUsClockVector;
 
-					for (const auto VideoStandard : VideoStandards)
-					{
-						DvConfig.VideoStandard = VideoStandard;
+FDeltacastDeviceProvider::FDeviceCacheRef FDeltacastDeviceProvider::LoadPersistentCache(const TArray<uint64>& HardwareIdentifier)
+{
+	const auto Path = DeltacastDeviceProvider::GetPersistentCachePath();
 
-						if (!DvConfig.IsValid(BoardHandle))
-						{
-							continue;
-						}
+	TArray<uint8> Data;
+	if (!FFileHelper::LoadFileToArray(Data, *Path, FILEREAD_Silent))
+	{
+		return nullptr;
+	}
 
-						const auto MediaMode = DeltacastDeviceProvider::ToMediaMode(DvConfig);
+	FMemoryReader Reader(Data);
+	FObjectAndNameAsStringProxyArchive Ar(Reader, false);
 
-						Results.Add(MediaMode);
-					}
-				}
-			}
+	uint32  Magic         = 0;
+	uint32  FormatVersion = 0;
+	FString PluginVersion;
+	uint32  ApiVersion    = 0;
+
+	Ar << Magic << FormatVersion;
+	if (Ar.IsError() || Magic != DeltacastDeviceProvider::PersistentCacheMagic || FormatVersion != DeltacastDeviceProvider::PersistentCacheFormatVersion)
+	{
+		UE_LOG(LogDeltacastMedia, Log, TEXT("Ignoring Deltacast device cache with unknown format: %s"), *Path);
+		return nullptr;
+	}
+
+	Ar << PluginVersion << ApiVersion;
+	if (PluginVersion != DeltacastDeviceProvider::GetPluginVersion() || ApiVersion != DeltacastDeviceProvider::GetApiVersion())
+	{
+		UE_LOG(LogDeltacastMedia, Log, TEXT("Ignoring Deltacast device cache made with another plugin or VideoMaster version"));
+		return nullptr;
+	}
+
+	const auto LoadedCache = MakeShared<FDeviceCache, ESPMode::ThreadSafe>();
+	LoadedCache->Serialize(Ar);
+
+	TArray<FDeltacastBoardCapabilities> BoardCapabilities;
+	Ar << BoardCapabilities;
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to read Deltacast device cache: %s"), *Path);
+		return nullptr;
+	}
+
+	if (LoadedCache->HardwareIdentifier != HardwareIdentifier)
+	{
+		UE_LOG(LogDeltacastMedia, Log, TEXT("Ignoring Deltacast device cache made with other boards"));
+		return nullptr;
+	}
+
+	auto& BoardRegistry = FDeltacast::GetBoardRegistry();
+	for (int32 BoardIndex = 0; BoardIndex < BoardCapabilities.Num(); ++BoardIndex)
+	{
+		if (const auto Board = BoardRegistry.Acquire(BoardIndex))
+		{
+			Board->MergeCapabilities(BoardCapabilities[BoardIndex]);
 		}
+	}
+
+	return LoadedCache;
+}
+
+void FDeltacastDeviceProvider::SavePersistentCache(FDeviceCache DeviceCache)
+{
+	const auto Path = DeltacastDeviceProvider::GetPersistentCachePath();
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+
+	uint32  Magic         = DeltacastDeviceProvider::PersistentCacheMagic;
+	uint32  FormatVersion = DeltacastDeviceProvider::PersistentCacheFormatVersion;
+	FString PluginVersion = DeltacastDeviceProvider::GetPluginVersion();
+	uint32  ApiVersion    = DeltacastDeviceProvider::GetApiVersion();
+
+	Ar << Magic << FormatVersion << PluginVersion << ApiVersion;
+
+	DeviceCache.Serialize(Ar);
 
-		[[maybe_unused]] const auto CloseBoardResult = DeltacastSdk.CloseBoardHandle(BoardHandle);
+	auto& BoardRegistry = FDeltacast::GetBoardRegistry();
+	const auto NbBoards = FDeltacast::GetSdk().GetNbBoards().value_or(0);
+
+	TArray<FDeltacastBoardCapabilities> BoardCapabilities;
+	BoardCapabilities.SetNum(NbBoards);
+	for (VHD::ULONG BoardIndex = 0; BoardIndex < NbBoards; ++BoardIndex)
+	{
+		if (const auto Board = BoardRegistry.Acquire(BoardIndex))
+		{
+			BoardCapabilities[BoardIndex] = Board->GetCapabilities();
+		}
 	}
 
-	return Results;
+	Ar << BoardCapabilities;
+
+	if (!FFileHelper::SaveArrayToFile(Data, *Path))
+	{
+		UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to write Deltacast device cache: %s"), *Path);
+	}
 }
 
 
-void FDeltacastDeviceProvider::UpdateCache() const
+void FDeltacastDeviceProvider::StartDeviceMonitor()
 {
-	FScopeLock Guard(&CacheCriticalSection);
+	check(DeviceMonitorThread == nullptr);
 
-	const auto HardwareIdentifier = ComputeCurrentHardwareIdentifier();
+	const auto StartTime = FPlatformTime::Seconds();
 
-	if (CacheHardwareIdentifier != HardwareIdentifier)
+	DeviceMonitor = MakeUnique<FDeltacastDeviceMonitor>([this, StartTime, bIsInitialEnumeration = true]() mutable
 	{
-		CacheHardwareIdentifier = HardwareIdentifier;
+		UpdateCache();
 
-		ConfigurationsInputCache    = GetConfigurations_Impl(true, false).Key;
-		const auto OutputConfigurations = GetConfigurations_Impl(false, true);
-		ConfigurationsOutputCache   = OutputConfigurations.Key;
-		ConfigurationsKeyOutputCache = OutputConfigurations.Value;
-		InputConfigurationsCache    = GetInputConfigurations_Impl();
-		OutputConfigurationsCache   = GetOutputConfigurations_Impl();
-		TimecodeConfigurationsCache = GetTimecodeConfigurations_Impl();
-		DevicesCache                = GetDevices_Impl();
-		ModesInputCache             = GetModes_Impl(true);
-		ModesOutputCache            = GetModes_Impl(false);
+		if (bIsInitialEnumeration)
+		{
+			bIsInitialEnumeration = false;
+			UE_LOG(LogDeltacastMedia, Display, TEXT("Deltacast initial device enumeration completed in %.1f ms"),
+			       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+		}
+	});
+
+	DeviceMonitorThread = FRunnableThread::Create(DeviceMonitor.Get(), TEXT("Deltacast Device Monitor"), 0, TPri_BelowNormal);
+	if (DeviceMonitorThread == nullptr)
+	{
+		UE_LOG(LogDeltacastMedia, Warning, TEXT("Failed to start Deltacast device monitor thread, hot-plugged boards won't be detected"));
+		DeviceMonitor.Reset();
+	}
+}
+
+void FDeltacastDeviceProvider::StopDeviceMonitor()
+{
+	if (DeviceMonitorThread != nullptr)
+	{
+		DeviceMonitorThread->Kill();
+		DeviceMonitorThread->WaitForCompletion();
+		delete DeviceMonitorThread;
+		DeviceMonitorThread = nullptr;
 	}
+
+	DeviceMonitor.Reset();
 }
 
 TArray<uint64> FDeltacastDeviceProvider::ComputeCurrentHardwareIdentifier()
@@ -908,39 +1081,20 @@ TArray<uint64> FDeltacastDeviceProvider::ComputeCurrentHardwareIdentifier()
 
 	const auto NbBoards = DeltacastSdk.GetNbBoards().value_or(0);
 
+	FDeltacast::GetBoardRegistry().SynchronizeBoardCount(NbBoards);
+
 	TArray<uint64> Identifier;
 	Identifier.Reserve(NbBoards);
 
 	for (VHD::ULONG BoardIndex = 0; BoardIndex < NbBoards; ++BoardIndex)
 	{
-		const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-		if (BoardHandle == VHD::InvalidHandle)
-		{
-			continue;
-		}
-
-		Deltacast::Helpers::TScopeExit CloseBoardHandle([BoardHandle, &DeltacastSdk]()
+		const auto BoardInfo = FDeltacast::GetBoardRegistry().GetBoardInfo(BoardIndex);
+		if (!BoardInfo.has_value())
 		{
-			DeltacastSdk.CloseBoardHandle(BoardHandle);
-		});
-
-		VHD::ULONG SerialLower = 0;
-		VHD::ULONG SerialUpper = 0;
-
-		const auto SerialLowerResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_CORE_BOARDPROPERTY::VHD_CORE_BP_SERIALNUMBER_LSW, &SerialLower);
-		const auto SerialUpperResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_CORE_BOARDPROPERTY::VHD_CORE_BP_SERIALNUMBER_MSW, &SerialUpper);
-
-		if (!Deltacast::Helpers::IsValid(SerialLowerResult) ||
-			!Deltacast::Helpers::IsValid(SerialUpperResult))
-		{
-			UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to get serial number of board %u: %s/%s"), BoardIndex,
-			       *Deltacast::Helpers::GetErrorString(SerialLowerResult), *Deltacast::Helpers::GetErrorString(SerialUpperResult));
 			continue;
 		}
 
-		const uint64 Serial = SerialLower + (uint64{ SerialUpper } << 32);
-
-		Identifier.Add(Serial);
+		Identifier.Add(BoardInfo->SerialNumber);
 	}
 
 	return Identifier;
@@ -15,6 +15,7 @@
 
 #include "DeltacastDeviceScanner.h"
 
+#include "DeltacastBoardRegistry.h"
 #include "DeltacastHelpers.h"
 #include "DeltacastSdk.h"
 #include "IDeltacastMediaModule.h"
@@ -24,14 +25,10 @@ namespace Deltacast::Device
 {
 	namespace Config
 	{
-		bool FBasePortConfig::IsValid(const VHDHandle BoardHandle) const
+		bool FBasePortConfig::IsValid(const FDeltacastBoard& Board) const
 		{
-			check(BoardHandle != VHD::InvalidHandle);
-
-			const auto& DeltacastSdk = FDeltacast::GetSdk();
-
-			const auto ChannelCount = bIsInput ? DeltacastSdk.GetRxCount(BoardHandle) : DeltacastSdk.GetTxCount(BoardHandle);
-			if (!ChannelCount || PortIndex >= ChannelCount)
+			const auto ChannelCount = bIsInput ? Board.GetInfo().RxCount : Board.GetInfo().TxCount;
+			if (PortIndex >= ChannelCount)
 			{
 				return false;
 			}
@@ -49,18 +46,14 @@ namespace Deltacast::Device
 		}
 
 
-		bool FSdiPortConfig::IsValid(const VHDHandle BoardHandle) const
+		bool FSdiPortConfig::IsValid(const FDeltacastBoard& Board) const
 		{
-			check(BoardHandle != VHD::InvalidHandle);
-
-			if (!Base.IsValid(BoardHandle))
+			if (!Base.IsValid(Board))
 			{
 				return false;
 			}
 
-			const auto& DeltacastSdk = FDeltacast::GetSdk();
-
-			const auto ChannelType = DeltacastSdk.GetChannelType(BoardHandle, Base.bIsInput, Base.PortIndex);
+			const auto ChannelType = Board.GetChannelType(Base.bIsInput, Base.PortIndex);
 			if (!ChannelType.has_value() ||
 				!Deltacast::Helpers::IsSdi(ChannelType.value()))
 			{
@@ -73,15 +66,13 @@ namespace Deltacast::Device
 				return false;
 			}
 
-			const auto StreamType         = GetStreamType();
-			const auto IsCapableInterface = DeltacastSdk.GetBoardCapSdiInterface(BoardHandle, StreamType, Interface);
-			if (!IsCapableInterface.value_or(false))
+			const auto StreamType = GetStreamType();
+			if (!Board.IsSdiInterfaceSupported(StreamType, Interface))
 			{
 				return false;
 			}
 
-			const auto IsCapableVideoStandard = DeltacastSdk.GetBoardCapSdiVideoStandard(BoardHandle, StreamType, VideoStandard);
-			if (!IsCapableVideoStandard.value_or(false))
+			if (!Board.IsSdiVideoStandardSupported(StreamType, VideoStandard))
 			{
 				return false;
 			}
@@ -103,14 +94,9 @@ namespace Deltacast::Device
 					return false;
 			}
 
-			const auto IsFlexModule = DeltacastSdk.IsFlexModule(BoardHandle);
-			if (!IsFlexModule.has_value())
-			{
-				return false;
-			}
-
-			if ((IsFlexModule.value() && VideoStandard == VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S259M_NTSC_487) ||
-				(!IsFlexModule.value() && VideoStandard == VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S259M_NTSC_480))
+			const auto IsFlexModule = Board.GetInfo().bIsFlexModule;
+			if ((IsFlexModule && VideoStandard == VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S259M_NTSC_487) ||
+				(!IsFlexModule && VideoStandard == VHD_VIDEOSTANDARD::VHD_VIDEOSTD_S259M_NTSC_480))
 			{
 				return false;
 			}
@@ -149,20 +135,16 @@ namespace Deltacast::Device
 		}
 
 
-		bool FDvPortConfig::IsValid(const VHDHandle BoardHandle) const
+		bool FDvPortConfig::IsValid(const FDeltacastBoard& Board) const
 		{
-			check(BoardHandle != VHD::InvalidHandle);
-
-			const auto& DeltacastSdk = FDeltacast::GetSdk();
-
-			const auto ChannelType = DeltacastSdk.GetChannelType(BoardHandle, Base.bIsInput, Base.PortIndex);
+			const auto ChannelType = Board.GetChannelType(Base.bIsInput, Base.PortIndex);
 			if (!ChannelType.has_value() ||
 				!Deltacast::Helpers::IsDv(ChannelType.value()))
 			{
 				return false;
 			}
 
-			return Base.IsValid(BoardHandle);
+			return Base.IsValid(Board);
 		}
 
 		FString FDvPortConfig::ToString() const
@@ -174,11 +156,21 @@ namespace Deltacast::Device
 	}
 
 
-	FSdiConfigIterator::FSdiConfigIterator(const uint32 BoardIndex): BoardIndex(BoardIndex) {}
+	FSdiConfigIterator::FSdiConfigIterator(const uint32 BoardIndex, const uint32 RxPortCount, const uint32 TxPortCount)
+		: BoardIndex(BoardIndex),
+		  RxPortCount(RxPortCount),
+		  TxPortCount(TxPortCount)
+	{
+		if (RxPortCount == 0)
+		{
+			bIsInput = false;
+			IsEnd    = TxPortCount == 0;
+		}
+	}
 
 	FSdiConfigIterator FSdiConfigIterator::end() const
 	{
-		FSdiConfigIterator Result(BoardIndex);
+		FSdiConfigIterator Result(BoardIndex, RxPortCount, TxPortCount);
 
 		Result.IsEnd = true;
 
@@ -238,11 +230,11 @@ namespace Deltacast::Device
 					bIsEuropeanClock = true;
 					PortIndex++;
 
-					if (PortIndex == VHD::MaxPortCount)
+					if (PortIndex == (bIsInput ? RxPortCount : TxPortCount))
 					{
 						PortIndex = 0;
 
-						if (bIsInput)
+						if (bIsInput && TxPortCount > 0)
 						{
 							bIsInput = false;
 						}
@@ -282,40 +274,57 @@ namespace Deltacast::Device
 			return {};
 		}
 
-		const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-
-		const auto InputSdiPortCount  = DeltacastSdk.GetSdiPortCount(BoardHandle, true);
-		const auto OutputSdiPortCount = DeltacastSdk.GetSdiPortCount(BoardHandle, false);
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(BoardIndex);
+		if (!Board.IsValid())
+		{
+			return {};
+		}
 
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
+		const auto InputSdiPortCount  = Board->GetSdiPortCount(true);
+		const auto OutputSdiPortCount = Board->GetSdiPortCount(false);
 
-		if (InputSdiPortCount.value_or(0) + OutputSdiPortCount.value_or(0) == 0)
+		if (InputSdiPortCount + OutputSdiPortCount == 0)
 		{
 			return {};
 		}
 
-		return FSdiDeviceScanner(BoardIndex);
+		return FSdiDeviceScanner(BoardIndex, Board->GetInfo().RxCount, Board->GetInfo().TxCount);
 	}
 
 	FSdiConfigIterator FSdiDeviceScanner::begin() const
 	{
-		return FSdiConfigIterator(BoardIndex);
+		return FSdiConfigIterator(BoardIndex, RxPortCount, TxPortCount);
 	}
 
 	FSdiConfigIterator FSdiDeviceScanner::end() const
 	{
-		return FSdiConfigIterator(BoardIndex).end();
+		return FSdiConfigIterator(BoardIndex, RxPortCount, TxPortCount).end();
 	}
 
-	FSdiDeviceScanner::FSdiDeviceScanner(const uint32 BoardIndex) : BoardIndex(BoardIndex) {}
+	FSdiDeviceScanner::FSdiDeviceScanner(const uint32 BoardIndex, const uint32 RxPortCount, const uint32 TxPortCount)
+		: BoardIndex(BoardIndex),
+		  RxPortCount(RxPortCount),
+		  TxPortCount(TxPortCount)
+	{
+	}
 
 
 
-	FDvConfigIterator::FDvConfigIterator(const uint32 BoardIndex) : BoardIndex(BoardIndex) {}
+	FDvConfigIterator::FDvConfigIterator(const uint32 BoardIndex, const uint32 RxPortCount, const uint32 TxPortCount)
+		: BoardIndex(BoardIndex),
+		  RxPortCount(RxPortCount),
+		  TxPortCount(TxPortCount)
+	{
+		if (RxPortCount == 0)
+		{
+			bIsInput = false;
+			IsEnd    = TxPortCount == 0;
+		}
+	}
 
 	FDvConfigIterator FDvConfigIterator::end() const
 	{
-		FDvConfigIterator Result(BoardIndex);
+		FDvConfigIterator Result(BoardIndex, RxPortCount, TxPortCount);
 
 		Result.IsEnd = true;
 
@@ -358,11 +367,11 @@ namespace Deltacast::Device
 				bIsEuropeanClock = true;
 				PortIndex++;
 
-				if (PortIndex == VHD::MaxPortCount)
+				if (PortIndex == (bIsInput ? RxPortCount : TxPortCount))
 				{
 					PortIndex = 0;
 
-					if (bIsInput)
+					if (bIsInput && TxPortCount > 0)
 					{
 						bIsInput = false;
 					}
@@ -400,22 +409,29 @@ namespace Deltacast::Device
 			return {};
 		}
 
-		const auto BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-
-		const auto InputSdiPortCount = DeltacastSdk.GetDvPortCount(BoardHandle, true);
-		const auto OutputSdiPortCount = DeltacastSdk.GetDvPortCount(BoardHandle, false);
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(BoardIndex);
+		if (!Board.IsValid())
+		{
+			return {};
+		}
 
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
+		const auto InputSdiPortCount = Board->GetDvPortCount(true);
+		const auto OutputSdiPortCount = Board->GetDvPortCount(false);
 
-		if (InputSdiPortCount.value_or(0) + OutputSdiPortCount.value_or(0) == 0)
+		if (InputSdiPortCount + OutputSdiPortCount == 0)
 		{
 			return {};
 		}
 
-		return FDvDeviceScanner(BoardIndex);
+		return FDvDeviceScanner(BoardIndex, Board->GetInfo().RxCount, Board->GetInfo().TxCount);
 	}
 
-	FDvDeviceScanner::FDvDeviceScanner(const uint32 BoardIndex) : BoardIndex(BoardIndex) { }
+	FDvDeviceScanner::FDvDeviceScanner(const uint32 BoardIndex, const uint32 RxPortCount, const uint32 TxPortCount)
+		: BoardIndex(BoardIndex),
+		  RxPortCount(RxPortCount),
+		  TxPortCount(TxPortCount)
+	{
+	}
 
 
 
@@ -85,7 +85,8 @@ void FDeltacastMediaModule::StartupModule()
 
 	GenlockSourceUpdater->InitializeGenlockSources();
 
-	DeviceProvider.UpdateCache();
+	// Enumerates the devices in the background, queries made before it completes wait for it
+	DeviceProvider.StartDeviceMonitor();
 
 	if (IMediaIOCoreModule::IsAvailable())
 	{
@@ -102,6 +103,8 @@ void FDeltacastMediaModule::ShutdownModule()
 		IMediaIOCoreModule::Get().UnregisterDeviceProvider(&DeviceProvider);
 	}
 
+	DeviceProvider.StopDeviceMonitor();
+
 	GenlockSourceUpdater->ShutdownGenlockSources();
 
 #if WITH_EDITOR
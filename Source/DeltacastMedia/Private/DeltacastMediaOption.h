@@ -28,6 +28,8 @@ namespace DeltacastMediaOption
 	static const FName LinkType("LinkType");
 	static const FName NumberOfDeltacastBuffers("NumberOfDeltacastBuffers");
 	static const FName NumberOfEngineBuffers("NumberOfEngineBuffers");
+	static const FName AdaptiveBufferDepth("AdaptiveBufferDepth");
+	static const FName MinimumNumberOfDeltacastBuffers("MinimumNumberOfDeltacastBuffers");
 	static const FName PixelFormat("PixelFormat");
 	static const FName PortIndex("PortIndex");
 	static const FName QuadLinkType("QuadLinkType");
@@ -35,4 +37,8 @@ namespace DeltacastMediaOption
 	static const FName LogDroppedFrameCount("LogDroppedFrameCount");
 	static const FName SdiVideoStandard("SdiVideoStandard");
 	static const FName DvVideoStandard("DvVideoStandard");
+	static const FName DeinterlaceMode("DeinterlaceMode");
+	static const FName Colorimetry("Colorimetry");
+	static const FName TransferFunction("TransferFunction");
+	static const FName HdrReferenceWhiteNits("HdrReferenceWhiteNits");
 }
\ No newline at end of file
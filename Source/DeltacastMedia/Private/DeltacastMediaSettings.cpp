@@ -17,6 +17,12 @@
 
 
 
+UDeltacastMediaSettings::UDeltacastMediaSettings()
+{
+	UnderrunFillerThread.Priority = EDeltacastThreadPriority::AboveNormal;
+}
+
+
 const FDeltacastBoardSettings *UDeltacastMediaSettings::GetBoardSettings(const int32 BoardIndex) const
 {
 	const auto Settings = BoardSettings.FindByPredicate([BoardIndex](const FDeltacastBoardSettings &Setting)
@@ -19,12 +19,112 @@
 #include "DeltacastHelpers.h"
 #include "DeltacastMediaSettings.h"
 #include "DeltacastSdk.h"
+#include "DeltacastThread.h"
 #include "IDeltacastMediaModule.h"
+#include "Engine/Engine.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/RunnableThread.h"
 #include "MediaIOCoreDefinitions.h"
 
 
+static FAutoConsoleCommand DeltacastDumpGenlockStatisticsCmd(
+	TEXT("Deltacast.CustomTimeStep.DumpGenlockStatistics"),
+	TEXT("Log the genlock tick interval, phase and jitter statistics of the active Deltacast custom timestep."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		const auto CustomTimeStep = GEngine != nullptr ? Cast<UDeltacastCustomTimeStep>(GEngine->GetCustomTimeStep()) : nullptr;
+		if (CustomTimeStep == nullptr)
+		{
+			UE_LOG(LogDeltacastMedia, Display, TEXT("The engine custom timestep is not a Deltacast custom timestep"));
+			return;
+		}
+
+		UE_LOG(LogDeltacastMedia, Display, TEXT("Genlock statistics of '%s':\n%s"), *CustomTimeStep->GetName(), *CustomTimeStep->GetGenlockStatistics().ToString());
+	}));
+
+static FAutoConsoleCommand DeltacastResetGenlockStatisticsCmd(
+	TEXT("Deltacast.CustomTimeStep.ResetGenlockStatistics"),
+	TEXT("Reset the genlock statistics of the active Deltacast custom timestep."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		if (const auto CustomTimeStep = GEngine != nullptr ? Cast<UDeltacastCustomTimeStep>(GEngine->GetCustomTimeStep()) : nullptr)
+		{
+			CustomTimeStep->ResetGenlockStatistics();
+		}
+	}));
+
+
+FString FDeltacastGenlockStatistics::ToString() const
+{
+	FString Result;
+
+	Result += FString::Printf(TEXT("\tTicks: %lld, missed: %lld, expected interval: %.3f ms\n"), TickCount, MissedTickCount, ExpectedIntervalMs);
+	Result += FString::Printf(TEXT("\tRelocks: %lld, last: %.3f ms, max: %.3f ms\n"), RelockCount, LastRelockTimeMs, MaxRelockTimeMs);
+	Result += FString::Printf(TEXT("\tInterval (ms): min %.3f, mean %.3f, max %.3f, stddev %.3f\n"), IntervalMinMs, IntervalMeanMs, IntervalMaxMs, IntervalStdDevMs);
+	Result += FString::Printf(TEXT("\tPhase (ms):    min %.3f, mean %.3f, max %.3f, stddev %.3f\n"), PhaseMinMs, PhaseMeanMs, PhaseMaxMs, PhaseStdDevMs);
+	Result += TEXT("\tJitter histogram:\n");
+
+	for (int32 BinIndex = 0; BinIndex < JitterHistogram.Num(); ++BinIndex)
+	{
+		const auto bIsLastBin = BinIndex == JitterHistogram.Num() - 1;
+		Result += FString::Printf(TEXT("\t\t%s%.2f ms: %d\n"), bIsLastBin ? TEXT(">= ") : TEXT("< "),
+		                          bIsLastBin ? BinIndex * JitterHistogramBinWidthMs : (BinIndex + 1) * JitterHistogramBinWidthMs,
+		                          JitterHistogram[BinIndex]);
+	}
+
+	return Result;
+}
+
+
+FDeltacastGenlockStatistics UDeltacastCustomTimeStep::GetGenlockStatistics() const
+{
+	FDeltacastGenlockStatistics Statistics;
+
+	if (!Updater.IsValid())
+	{
+		return Statistics;
+	}
+
+	static constexpr auto SecToMs = 1000.0;
+
+	const auto Timing = Updater->GetGenlockTiming();
+
+	Statistics.TickCount          = static_cast<int64>(Timing.TickCount);
+	Statistics.MissedTickCount    = static_cast<int64>(Timing.MissedTickCount);
+	Statistics.ExpectedIntervalMs = Timing.ExpectedTickInterval * SecToMs;
+
+	Statistics.RelockCount      = static_cast<int64>(Timing.RelockCount);
+	Statistics.LastRelockTimeMs = Timing.LastRelockTime * SecToMs;
+	Statistics.MaxRelockTimeMs  = Timing.MaxRelockTime * SecToMs;
+
+	Statistics.IntervalMinMs    = Timing.TickInterval.Min * SecToMs;
+	Statistics.IntervalMeanMs   = Timing.TickInterval.Mean * SecToMs;
+	Statistics.IntervalMaxMs    = Timing.TickInterval.Max * SecToMs;
+	Statistics.IntervalStdDevMs = Timing.TickInterval.StdDev * SecToMs;
+
+	Statistics.PhaseMinMs    = Timing.FrameStartOffset.Min * SecToMs;
+	Statistics.PhaseMeanMs   = Timing.FrameStartOffset.Mean * SecToMs;
+	Statistics.PhaseMaxMs    = Timing.FrameStartOffset.Max * SecToMs;
+	Statistics.PhaseStdDevMs = Timing.FrameStartOffset.StdDev * SecToMs;
+
+	Statistics.JitterHistogramBinWidthMs = FDeltacastCustomTimeStepUpdater::JitterHistogramBinWidthSec * SecToMs;
+	for (const auto BinCount : Timing.JitterHistogram)
+	{
+		Statistics.JitterHistogram.Add(static_cast<int32>(BinCount));
+	}
+
+	return Statistics;
+}
+
+void UDeltacastCustomTimeStep::ResetGenlockStatistics()
+{
+	if (Updater.IsValid())
+	{
+		Updater->ResetGenlockTiming();
+	}
+}
+
+
 bool UDeltacastCustomTimeStep::Initialize(UEngine *InEngine)
 {
 #if WITH_EDITORONLY_DATA
@@ -88,7 +188,8 @@ bool UDeltacastCustomTimeStep::Initialize(UEngine *InEngine)
 	Config.BoardIndex    = BoardIndex;
 
 	Updater = MakeUnique<FDeltacastCustomTimeStepUpdater>(Config);
-	UpdaterThread = FRunnableThread::Create(Updater.Get(), *FString::Printf(TEXT("Deltacast Custom Timestep %s"), *GetName()));
+	UpdaterThread = Deltacast::Thread::Create(Updater.Get(), *FString::Printf(TEXT("Deltacast Custom Timestep %s"), *GetName()),
+	                                          GetDefault<UDeltacastMediaSettings>()->TimeStepThread, BoardIndex);
 	if (UpdaterThread == nullptr)
 	{
 		UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to start Deltacast Custom Timestep thread"));
@@ -145,6 +246,8 @@ bool UDeltacastCustomTimeStep::UpdateTimeStep(UEngine* InEngine)
 	check(State == ECustomTimeStepSynchronizationState::Synchronized ||
 	      State == ECustomTimeStepSynchronizationState::Synchronizing);
 
+	Updater->RecordFrameStart(FPlatformTime::Seconds());
+
 	{
 		static const auto CVar = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.VSync"));
 		if (!bWarnedAboutVSync)
@@ -233,16 +336,30 @@ bool UDeltacastCustomTimeStep::WaitForSync()
 
 	SyncCountDelta = 1;
 
-	const bool bIsWaitValid = Updater.Get()->WaitForSync();
+	const auto WaitedSyncCount = [this]() -> std::optional<uint32>
+	{
+		if (EarlyReleaseOffsetMs > 0.0f)
+		{
+			const auto LastConsumedSyncCount = bIsPreviousSyncCountValid ? std::optional<uint32>(PreviousSyncCount) : std::nullopt;
+			return Updater.Get()->WaitForEarlyRelease(EarlyReleaseOffsetMs / 1000.0, LastConsumedSyncCount);
+		}
+
+		if (!Updater.Get()->WaitForSync())
+		{
+			return {};
+		}
+
+		return Updater.Get()->GetSyncCount();
+	}();
 
-	if (!bIsWaitValid)
+	if (!WaitedSyncCount.has_value())
 	{
 		State = ECustomTimeStepSynchronizationState::Error;
 		bIsPreviousSyncCountValid = false;
 		return false;
 	}
 
-	const auto SyncCount = Updater.Get()->GetSyncCount();
+	const auto SyncCount = WaitedSyncCount.value();
 
 	if (bIsPreviousSyncCountValid)
 	{
@@ -18,6 +18,61 @@
 #include "DeltacastHelpers.h"
 #include "DeltacastSdk.h"
 #include "IDeltacastMediaModule.h"
+#include "Misc/ScopeLock.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+
+void FDeltacastRollingSamples::Add(const double Sample)
+{
+	Samples[NextIndex] = Sample;
+
+	NextIndex   = (NextIndex + 1) % Capacity;
+	SampleCount = std::min(SampleCount + 1, Capacity);
+}
+
+void FDeltacastRollingSamples::Reset()
+{
+	NextIndex   = 0;
+	SampleCount = 0;
+}
+
+FDeltacastRollingStatistics FDeltacastRollingSamples::Compute() const
+{
+	FDeltacastRollingStatistics Statistics;
+
+	if (SampleCount == 0)
+	{
+		return Statistics;
+	}
+
+	Statistics.SampleCount = SampleCount;
+	Statistics.Min         = Samples[0];
+	Statistics.Max         = Samples[0];
+
+	double Sum = 0.0;
+	for (int32 Index = 0; Index < SampleCount; ++Index)
+	{
+		Statistics.Min = std::min(Statistics.Min, Samples[Index]);
+		Statistics.Max = std::max(Statistics.Max, Samples[Index]);
+		Sum += Samples[Index];
+	}
+
+	Statistics.Mean = Sum / SampleCount;
+
+	double SquaredDeviationSum = 0.0;
+	for (int32 Index = 0; Index < SampleCount; ++Index)
+	{
+		const auto Deviation = Samples[Index] - Statistics.Mean;
+		SquaredDeviationSum += Deviation * Deviation;
+	}
+
+	Statistics.StdDev = std::sqrt(SquaredDeviationSum / SampleCount);
+
+	return Statistics;
+}
 
 
 
@@ -45,14 +100,16 @@ bool FDeltacastCustomTimeStepUpdater::Init()
 		return false;
 	}
 
-	BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-	if (BoardHandle == VHD::InvalidHandle)
+	Board = FDeltacast::GetBoardRegistry().Acquire(BoardIndex);
+	if (!Board.IsValid())
 	{
 		Callback->OnInitializationCompleted(false);
 		Exit();
 		return false;
 	}
 
+	BoardHandle = Board->GetHandle();
+
 	const auto StartResult = DeltacastSdk.StartTimer(BoardHandle, VHD_TIMER_SOURCE::VHD_TIMER_SOURCE_GENLOCK, &TimerHandle);
 	if (!Deltacast::Helpers::IsValid(StartResult))
 	{
@@ -77,6 +134,7 @@ uint32 FDeltacastCustomTimeStepUpdater::Run()
 	while (!bStopRequested)
 	{
 		const auto WaitResult = DeltacastSdk.WaitOnNextTimerTick(TimerHandle, Deltacast::Helpers::GenlockWaitTimeOutMs);
+		const auto TickTime   = FPlatformTime::Seconds();
 
 		VHD::ULONG Status              = 0;
 		const auto GenlockStatusResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_SDI_BOARDPROPERTY::VHD_SDI_BP_GENLOCK_STATUS, &Status);
@@ -96,13 +154,30 @@ uint32 FDeltacastCustomTimeStepUpdater::Run()
 
 		if (!bIsSynchronized)
 		{
-			WaitAndDetectGenlock();
+			{
+				// The reacquisition time must not be accounted as a tick interval
+				FScopeLock Guard(&TimingCriticalSection);
+				LastTickTime = 0.0;
+			}
+
+			if (!FastReacquireGenlock())
+			{
+				WaitAndDetectGenlock();
+			}
+
 			bIsSynchronized = !bStopRequested;
+
+			if (bIsSynchronized)
+			{
+				RecordRelock(FPlatformTime::Seconds() - TickTime);
+			}
 		}
 		else
 		{
-			WaitForSyncEvent->Trigger();
 			++SyncCount;
+			RecordTick(TickTime);
+
+			WaitForSyncEvent->Trigger();
 		}
 	}
 
@@ -121,10 +196,11 @@ void FDeltacastCustomTimeStepUpdater::Exit()
 			TimerHandle = VHD::InvalidHandle;
 		}
 
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
 		BoardHandle = VHD::InvalidHandle;
 	}
 
+	Board.Reset();
+
 	FPlatformProcess::ReturnSynchEventToPool(WaitForSyncEvent);
 	WaitForSyncEvent = nullptr;
 }
@@ -144,6 +220,61 @@ bool FDeltacastCustomTimeStepUpdater::WaitForSync() const
 	return !bStopRequested;
 }
 
+std::optional<uint32> FDeltacastCustomTimeStepUpdater::WaitForEarlyRelease(const double EarlyReleaseOffset, const std::optional<uint32> LastConsumedSyncCount) const
+{
+	double ReferenceTickTime  = 0.0;
+	uint32 ReferenceSyncCount = 0;
+	double TickPeriod         = 0.0;
+
+	{
+		FScopeLock Guard(&TimingCriticalSection);
+
+		const auto Interval = TickIntervalSamples.Compute();
+
+		ReferenceTickTime  = LastTickTime;
+		ReferenceSyncCount = LastTickSyncCount;
+		TickPeriod         = Interval.SampleCount >= MinEarlyReleaseSampleCount ? Interval.Mean : ExpectedTickInterval;
+	}
+
+	if (!bIsSynchronized || ReferenceTickTime <= 0.0 || TickPeriod <= 0.0)
+	{
+		if (!WaitForSync())
+		{
+			return {};
+		}
+
+		return SyncCount;
+	}
+
+	// The frame targets the first tick that is neither consumed by a previous frame nor already past
+	const auto TargetSyncCount = std::max(LastConsumedSyncCount.value_or(ReferenceSyncCount) + 1, ReferenceSyncCount + 1);
+
+	// Never release before the previous tick
+	const auto Offset      = std::min(EarlyReleaseOffset, TickPeriod * 0.9);
+	const auto ReleaseTime = ReferenceTickTime + (TargetSyncCount - ReferenceSyncCount) * TickPeriod - Offset;
+
+	while (!bStopRequested && bIsSynchronized)
+	{
+		const auto Remaining = ReleaseTime - FPlatformTime::Seconds();
+		if (Remaining <= 0.0)
+		{
+			break;
+		}
+
+		FPlatformProcess::SleepNoStats(Remaining > EarlyReleaseSpinSec ? static_cast<float>(Remaining - EarlyReleaseSpinSec) : 0.0f);
+	}
+
+	// The tick event is not consumed while releasing early, don't let a stale trigger release a later regular wait
+	WaitForSyncEvent->Reset();
+
+	if (bStopRequested)
+	{
+		return {};
+	}
+
+	return TargetSyncCount;
+}
+
 
 uint32 FDeltacastCustomTimeStepUpdater::GetSyncCount() const
 {
@@ -177,6 +308,98 @@ FFrameRate FDeltacastCustomTimeStepUpdater::GetSyncRate() const
 }
 
 
+
+void FDeltacastCustomTimeStepUpdater::RecordFrameStart(const double FrameStartTime)
+{
+	FScopeLock Guard(&TimingCriticalSection);
+
+	if (LastTickTime > 0.0)
+	{
+		FrameStartOffsetSamples.Add(FrameStartTime - LastTickTime);
+	}
+}
+
+FDeltacastGenlockTiming FDeltacastCustomTimeStepUpdater::GetGenlockTiming() const
+{
+	FScopeLock Guard(&TimingCriticalSection);
+
+	FDeltacastGenlockTiming Timing;
+
+	Timing.TickInterval     = TickIntervalSamples.Compute();
+	Timing.FrameStartOffset = FrameStartOffsetSamples.Compute();
+	Timing.JitterHistogram  = TArray<uint32>(JitterHistogram.data(), JitterHistogram.size());
+
+	Timing.ExpectedTickInterval = ExpectedTickInterval;
+
+	Timing.TickCount       = TickCount;
+	Timing.MissedTickCount = MissedTickCount;
+
+	Timing.LastRelockTime = LastRelockTime;
+	Timing.MaxRelockTime  = MaxRelockTime;
+	Timing.RelockCount    = RelockCount;
+
+	return Timing;
+}
+
+void FDeltacastCustomTimeStepUpdater::ResetGenlockTiming()
+{
+	FScopeLock Guard(&TimingCriticalSection);
+
+	TickIntervalSamples.Reset();
+	FrameStartOffsetSamples.Reset();
+	JitterHistogram.fill(0);
+
+	TickCount       = 0;
+	MissedTickCount = 0;
+
+	LastRelockTime = 0.0;
+	MaxRelockTime  = 0.0;
+	RelockCount    = 0;
+}
+
+
+void FDeltacastCustomTimeStepUpdater::RecordTick(const double TickTime)
+{
+	FScopeLock Guard(&TimingCriticalSection);
+
+	if (LastTickTime > 0.0)
+	{
+		const auto Interval = TickTime - LastTickTime;
+
+		TickIntervalSamples.Add(Interval);
+
+		if (ExpectedTickInterval > 0.0)
+		{
+			// A late tick covering more than one period means the timer skipped ticks in between
+			const auto ElapsedPeriods = static_cast<int64>(std::llround(Interval / ExpectedTickInterval));
+			if (ElapsedPeriods > 1)
+			{
+				MissedTickCount += static_cast<uint64>(ElapsedPeriods - 1);
+			}
+
+			const auto Jitter   = std::abs(Interval - ExpectedTickInterval);
+			const auto BinIndex = std::min(static_cast<int32>(Jitter / JitterHistogramBinWidthSec), JitterHistogramBinCount - 1);
+			++JitterHistogram[BinIndex];
+		}
+	}
+
+	LastTickTime      = TickTime;
+	LastTickSyncCount = SyncCount;
+	++TickCount;
+}
+
+void FDeltacastCustomTimeStepUpdater::RecordRelock(const double RelockTime)
+{
+	UE_LOG(LogDeltacastMedia, Display, TEXT("Genlock locked again %.2f ms after the loss"), RelockTime * 1000.0);
+
+	FScopeLock Guard(&TimingCriticalSection);
+
+	LastRelockTime = RelockTime;
+	MaxRelockTime  = std::max(MaxRelockTime, RelockTime);
+	++RelockCount;
+}
+
+
 void FDeltacastCustomTimeStepUpdater::WaitAndDetectGenlock()
 {
 	auto &DeltacastSdk = FDeltacast::GetSdk();
@@ -280,8 +503,121 @@ void FDeltacastCustomTimeStepUpdater::WaitAndDetectGenlock()
 
 		if (bHasReference && bIsLocked)
 		{
+			// Also reached when the board was already locked, or relocked by itself on a new format
+			if (!UpdateGenlockFormat())
+			{
+				continue;
+			}
+
 			break;
 		}
 	}
 	while (!bStopRequested);
+
+	const auto SyncInterval = GetSyncRate().AsInterval();
+
+	FScopeLock Guard(&TimingCriticalSection);
+	ExpectedTickInterval = SyncInterval;
+}
+
+bool FDeltacastCustomTimeStepUpdater::FastReacquireGenlock()
+{
+	const auto &DeltacastSdk = FDeltacast::GetSdk();
+
+	const auto TickPeriod = [this]()
+	{
+		FScopeLock Guard(&TimingCriticalSection);
+		return ExpectedTickInterval;
+	}();
+
+	if (TickPeriod <= 0.0)
+	{
+		return false;
+	}
+
+	// The timer keeps running, as long as the reference format is unchanged the board relocks by itself
+	const auto Deadline = FPlatformTime::Seconds() + Deltacast::Helpers::GenlockFastReacquisitionFrameCount * TickPeriod;
+
+	while (!bStopRequested && FPlatformTime::Seconds() < Deadline)
+	{
+		VHD::ULONG Status              = 0;
+		const auto GenlockStatusResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_SDI_BOARDPROPERTY::VHD_SDI_BP_GENLOCK_STATUS, &Status);
+
+		if (Deltacast::Helpers::IsValid(GenlockStatusResult))
+		{
+			const auto bHasReference = (Status & VHD::VHD_SDI_GNLKSTS_NOREF) == 0;
+			const auto bIsLocked     = (Status & VHD::VHD_SDI_GNLKSTS_UNLOCKED) == 0;
+
+			if (bHasReference && bIsLocked)
+			{
+				return true;
+			}
+
+			if (bHasReference && HasGenlockFormatChanged())
+			{
+				UE_LOG(LogDeltacastMedia, Display, TEXT("Genlock reference format changed, detecting the new format"));
+				return false;
+			}
+		}
+
+		FPlatformProcess::SleepNoStats(Deltacast::Helpers::GenlockFastStatusSleepSec);
+	}
+
+	return false;
+}
+
+bool FDeltacastCustomTimeStepUpdater::HasGenlockFormatChanged() const
+{
+	const auto &DeltacastSdk = FDeltacast::GetSdk();
+
+	if (GenlockVideoStandard == VHD_VIDEOSTANDARD::NB_VHD_VIDEOSTANDARDS)
+	{
+		return true;
+	}
+
+	VHD::ULONG VideoStandard              = 0;
+	const auto GenlockVideoStandardResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_SDI_BOARDPROPERTY::VHD_SDI_BP_GENLOCK_VIDEO_STANDARD, &VideoStandard);
+	if (!Deltacast::Helpers::IsValid(GenlockVideoStandardResult))
+	{
+		return true;
+	}
+
+	VHD::ULONG ClockDivisor              = 0;
+	const auto GenlockClockDivisorResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_SDI_BOARDPROPERTY::VHD_SDI_BP_CLOCK_SYSTEM, &ClockDivisor);
+	if (!Deltacast::Helpers::IsValid(GenlockClockDivisorResult))
+	{
+		return true;
+	}
+
+	const auto bIsEuropeanClockDivisor = static_cast<VHD_CLOCKDIVISOR>(ClockDivisor) == VHD_CLOCKDIVISOR::VHD_CLOCKDIV_1;
+
+	return static_cast<VHD_VIDEOSTANDARD>(VideoStandard) != GenlockVideoStandard || bIsEuropeanClockDivisor != bIsEuropeanClock;
+}
+
+bool FDeltacastCustomTimeStepUpdater::UpdateGenlockFormat()
+{
+	const auto &DeltacastSdk = FDeltacast::GetSdk();
+
+	VHD::ULONG VideoStandard              = 0;
+	const auto GenlockVideoStandardResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_SDI_BOARDPROPERTY::VHD_SDI_BP_GENLOCK_VIDEO_STANDARD, &VideoStandard);
+	if (!Deltacast::Helpers::IsValid(GenlockVideoStandardResult))
+	{
+		UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to get genlock video standard: %s"),
+		       *Deltacast::Helpers::GetErrorString(GenlockVideoStandardResult));
+		return false;
+	}
+
+	VHD::ULONG ClockDivisor              = 0;
+	const auto GenlockClockDivisorResult = DeltacastSdk.GetBoardProperty(BoardHandle, VHD_SDI_BOARDPROPERTY::VHD_SDI_BP_CLOCK_SYSTEM, &ClockDivisor);
+	if (!Deltacast::Helpers::IsValid(GenlockClockDivisorResult))
+	{
+		UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to get genlock clock divisor: %s"),
+		       *Deltacast::Helpers::GetErrorString(GenlockClockDivisorResult));
+		return false;
+	}
+
+	bIsEuropeanClock     = static_cast<VHD_CLOCKDIVISOR>(ClockDivisor) == VHD_CLOCKDIVISOR::VHD_CLOCKDIV_1;
+	GenlockVideoStandard = static_cast<VHD_VIDEOSTANDARD>(VideoStandard);
+
+	return true;
 }
@@ -15,11 +15,16 @@
 
 #pragma once
 
+#include "DeltacastBoardRegistry.h"
 #include "DeltacastDefinition.h"
+#include "HAL/CriticalSection.h"
 #include "HAL/Event.h"
 #include "HAL/Runnable.h"
 #include "Misc/FrameRate.h"
 
+#include <array>
+#include <optional>
+
 
 class IDeltacastCustomTimeStepCallback
 {
@@ -38,6 +43,61 @@ struct FDeltacastCustomTimeStepConfig final
 	int32 BoardIndex;
 };
 
+
+struct FDeltacastRollingStatistics final
+{
+	double Min    = 0.0;
+	double Mean   = 0.0;
+	double Max    = 0.0;
+	double StdDev = 0.0;
+
+	int32 SampleCount = 0;
+};
+
+/**
+ * Fixed size ring of the last samples, statistics are computed over the samples still in the window.
+ */
+class FDeltacastRollingSamples final
+{
+public:
+	void Add(double Sample);
+	void Reset();
+
+	[[nodiscard]] FDeltacastRollingStatistics Compute() const;
+
+public:
+	inline static constexpr int32 Capacity = 512;
+
+private:
+	std::array<double, Capacity> Samples{};
+
+	int32 NextIndex   = 0;
+	int32 SampleCount = 0;
+};
+
+struct FDeltacastGenlockTiming final
+{
+	/** Interval between two consecutive genlock ticks, in seconds */
+	FDeltacastRollingStatistics TickInterval;
+
+	/** Offset between the last genlock tick and the start of the engine frame, in seconds */
+	FDeltacastRollingStatistics FrameStartOffset;
+
+	/** Count of |interval - expected interval| per bin of `JitterHistogramBinWidthSec`, the last bin holds everything above */
+	TArray<uint32> JitterHistogram;
+
+	double ExpectedTickInterval = 0.0;
+
+	uint64 TickCount       = 0;
+	uint64 MissedTickCount = 0;
+
+	/** Time between a genlock loss and the next lock, in seconds */
+	double LastRelockTime = 0.0;
+	double MaxRelockTime  = 0.0;
+
+	uint64 RelockCount = 0;
+};
+
 class FDeltacastCustomTimeStepUpdater final : public FRunnable
 {
 public:
@@ -53,15 +113,52 @@ public: //~ FRunnable
 public:
 	[[nodiscard]] bool WaitForSync() const;
 
+	/**
+	 * Wait until `EarlyReleaseOffset` seconds before the predicted time of the next genlock tick not yet consumed.
+	 * The prediction is based on the measured tick period, it falls back to `WaitForSync()` when no prediction is possible.
+	 * @return The sync count the released frame is attributed to, empty if a stop was requested
+	 */
+	[[nodiscard]] std::optional<uint32> WaitForEarlyRelease(double EarlyReleaseOffset, std::optional<uint32> LastConsumedSyncCount) const;
+
 	[[nodiscard]] uint32 GetSyncCount() const;
 
 	[[nodiscard]] bool IsGenlockSynchronized() const;
 
 	[[nodiscard]] FFrameRate GetSyncRate() const;
 
+public:
+	void RecordFrameStart(double FrameStartTime);
+
+	[[nodiscard]] FDeltacastGenlockTiming GetGenlockTiming() const;
+
+	void ResetGenlockTiming();
+
+public:
+	inline static constexpr double JitterHistogramBinWidthSec = 0.1 / 1000.0;
+	inline static constexpr int32  JitterHistogramBinCount    = 20;
+
+	/** Minimum number of measured intervals before the tick period is trusted for early release */
+	inline static constexpr int32  MinEarlyReleaseSampleCount = 8;
+	/** Time before the release where the wait stops sleeping and spins */
+	inline static constexpr double EarlyReleaseSpinSec        = 2.0 / 1000.0;
+
 private:
 	void WaitAndDetectGenlock();
 
+	/**
+	 * Poll the genlock status at a fast pace during the first frames after a loss, without reprogramming the board.
+	 * @return true if the genlock is locked again, false if the slow detection is required
+	 */
+	[[nodiscard]] bool FastReacquireGenlock();
+
+	[[nodiscard]] bool HasGenlockFormatChanged() const;
+
+	/** Store the format of the locked reference as the baseline of `HasGenlockFormatChanged` */
+	[[nodiscard]] bool UpdateGenlockFormat();
+
+	void RecordTick(double TickTime);
+	void RecordRelock(double RelockTime);
+
 private:
 	bool bStopRequested = false;
 
@@ -77,8 +174,31 @@ private:
 	int32 BoardIndex = -1;
 
 private:
+	FDeltacastBoardRef Board;
+
 	VHDHandle BoardHandle = VHD::InvalidHandle;
 	VHDHandle TimerHandle = VHD::InvalidHandle;
 
 	mutable FEvent *WaitForSyncEvent = nullptr;
+
+private:
+	mutable FCriticalSection TimingCriticalSection;
+
+	FDeltacastRollingSamples TickIntervalSamples;
+	FDeltacastRollingSamples FrameStartOffsetSamples;
+
+	std::array<uint32, JitterHistogramBinCount> JitterHistogram{};
+
+	/** Time of the last genlock tick, 0 when the next tick doesn't follow a valid one */
+	double LastTickTime         = 0.0;
+	double ExpectedTickInterval = 0.0;
+
+	uint32 LastTickSyncCount = 0;
+
+	uint64 TickCount       = 0;
+	uint64 MissedTickCount = 0;
+
+	double LastRelockTime = 0.0;
+	double MaxRelockTime  = 0.0;
+	uint64 RelockCount    = 0;
 };
\ No newline at end of file
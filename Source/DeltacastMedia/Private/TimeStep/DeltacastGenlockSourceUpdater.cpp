@@ -51,16 +51,9 @@ void FDeltacastGenlockSourceUpdater::InitializeGenlockSources()
 void FDeltacastGenlockSourceUpdater::ShutdownGenlockSources()
 {
 #if WITH_EDITOR
-	auto& DeltacastSdk = FDeltacast::GetSdk();
-
 	UDeltacastMediaSettings::OnSettingsChanged().Remove(UpdateSettingsDelegateHandle);
 	UpdateSettingsDelegateHandle.Reset();
 
-	for (const auto& [BoardIndex, BoardGenlock] : BoardGenlockSource)
-	{
-		DeltacastSdk.CloseBoardHandle(BoardGenlock.BoardHandle);
-	}
-
 	BoardGenlockSource.Reset();
 #endif
 }
@@ -110,8 +103,6 @@ void FDeltacastGenlockSourceUpdater::UpdateGenlockSource(const FDeltacastBoardSe
 		return;
 	}
 
-	auto& DeltacastSdk = FDeltacast::GetSdk();
-
 	const auto NewGenlockSource = Convert(BoardSettings.GenlockSource);
 
 #if WITH_EDITOR
@@ -119,19 +110,19 @@ void FDeltacastGenlockSourceUpdater::UpdateGenlockSource(const FDeltacastBoardSe
 	if (ExistingBoardGenlock == nullptr)
 #endif
 	{
-		// New board index
-		const auto BoardHandle = DeltacastSdk.OpenBoard(BoardSettings.BoardIndex).value_or(VHD::InvalidHandle);
-		if (BoardHandle == VHD::InvalidHandle)
+		// New board index, the registry keeps the board open for the session
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(BoardSettings.BoardIndex);
+		if (!Board.IsValid())
 		{
 			UE_LOG(LogDeltacastMedia, Error, TEXT("Cannot open board %d, genlock source won't be set"), BoardSettings.BoardIndex);
 			return;
 		}
 
 		// TODO @JV v1: improvement: on error (popup? show in settings the current applied settings?)
-		SetGenlockSource(BoardHandle, NewGenlockSource);
+		SetGenlockSource(Board->GetHandle(), NewGenlockSource);
 
 #if WITH_EDITOR
-		BoardGenlockSource.Add(BoardSettings.BoardIndex, FBoardGenlock{ NewGenlockSource, BoardHandle });
+		BoardGenlockSource.Add(BoardSettings.BoardIndex, FBoardGenlock{ NewGenlockSource, Board });
 #endif
 	}
 #if WITH_EDITOR
@@ -145,7 +136,7 @@ void FDeltacastGenlockSourceUpdater::UpdateGenlockSource(const FDeltacastBoardSe
 		}
 
 		// TODO @JV v1: improvement: on error (popup? show in settings the current applied settings?)
-		SetGenlockSource(ExistingBoardGenlock->BoardHandle, NewGenlockSource);
+		SetGenlockSource(ExistingBoardGenlock->Board->GetHandle(), NewGenlockSource);
 
 		ExistingBoardGenlock->GenlockSource = NewGenlockSource;
 	}
@@ -18,6 +18,7 @@
 #if WITH_EDITOR
 #include "Delegates/IDelegateInstance.h"
 #endif
+#include "DeltacastBoardRegistry.h"
 #include "DeltacastDefinition.h"
 #include "DeltacastMediaSettings.h"
 #include "Templates/SharedPointer.h"
@@ -51,7 +52,7 @@ private:
 	{
 		VHD_GENLOCKSOURCE GenlockSource = VHD_GENLOCKSOURCE::NB_VHD_GENLOCKSOURCES;
 
-		VHDHandle BoardHandle = VHD::InvalidHandle;
+		FDeltacastBoardRef Board;
 	};
 
 	TMap<int32, FBoardGenlock> BoardGenlockSource;
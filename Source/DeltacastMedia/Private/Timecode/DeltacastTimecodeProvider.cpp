@@ -18,6 +18,7 @@
 #include "DeltacastHelpers.h"
 #include "DeltacastMediaSettings.h"
 #include "DeltacastSdk.h"
+#include "DeltacastThread.h"
 #include "DeltacastTimecodeUpdater.h"
 #include "IDeltacastMediaModule.h"
 #include "HAL/RunnableThread.h"
@@ -113,7 +114,8 @@ bool UDeltacastTimecodeProvider::Initialize(UEngine* InEngine)
 	Config.TimecodeSource = TimecodeSource.value();
 
 	Updater = MakeUnique<FDeltacastTimecodeUpdater>(Config);
-	UpdaterThread = FRunnableThread::Create(Updater.Get(), *FString::Printf(TEXT("Deltacast Timecode Provider %s"), *GetName()));
+	UpdaterThread = Deltacast::Thread::Create(Updater.Get(), *FString::Printf(TEXT("Deltacast Timecode Provider %s"), *GetName()),
+	                                          GetDefault<UDeltacastMediaSettings>()->TimecodeThread, BoardIndex);
 	if (UpdaterThread == nullptr)
 	{
 		UE_LOG(LogDeltacastMedia, Error, TEXT("Failed to start Deltacast timecode thread"));
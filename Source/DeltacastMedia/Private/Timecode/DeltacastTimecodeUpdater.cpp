@@ -93,14 +93,16 @@ bool FDeltacastTimecodeUpdater::Init()
 {
 	auto &DeltacastSdk = FDeltacast::GetSdk();
 
-	BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-	if (BoardHandle == VHD::InvalidHandle)
+	Board = FDeltacast::GetBoardRegistry().Acquire(BoardIndex);
+	if (!Board.IsValid())
 	{
 		Callback->OnInitializationCompleted(false);
 		Exit();
 		return false;
 	}
 
+	BoardHandle = Board->GetHandle();
+
 	if (TimecodeSource == VHD_TIMECODE_SOURCE::VHD_TC_SRC_LTC_COMPANION_CARD)
 	{
 		bool       IsPresent           = false;
@@ -201,13 +203,8 @@ uint32 FDeltacastTimecodeUpdater::Run()
 
 void FDeltacastTimecodeUpdater::Exit()
 {
-	auto &DeltacastSdk = FDeltacast::GetSdk();
-
-	if (BoardHandle != VHD::InvalidHandle)
-	{
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
-		BoardHandle = VHD::InvalidHandle;
-	}
+	BoardHandle = VHD::InvalidHandle;
+	Board.Reset();
 }
 
 void FDeltacastTimecodeUpdater::Stop()
@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "DeltacastBoardRegistry.h"
 #include "DeltacastDefinition.h"
 #include "HAL/Runnable.h"
 #include "Misc/FrameRate.h"
@@ -84,6 +85,8 @@ private:
 	VHD_TIMECODE_SOURCE TimecodeSource = VHD_TIMECODE_SOURCE::NB_VHD_TC_SRC;
 
 private:
+	FDeltacastBoardRef Board;
+
 	VHDHandle BoardHandle = VHD::InvalidHandle;
 
 	mutable FCriticalSection TimecodeCriticalSection;
@@ -21,6 +21,79 @@
 #include "DeltacastCustomTimeStep.generated.h"
 
 
+/**
+ * Genlock tick timing measured over the last ticks, durations are in milliseconds.
+ */
+USTRUCT(BlueprintType)
+struct DELTACASTMEDIA_API FDeltacastGenlockStatistics
+{
+	GENERATED_BODY()
+
+public:
+	/** Number of genlock ticks received since the statistics were reset */
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock")
+	int64 TickCount = 0;
+
+	/** Number of genlock ticks skipped by the timer since the statistics were reset */
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock")
+	int64 MissedTickCount = 0;
+
+	/** Interval between two ticks expected from the genlock video standard */
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock")
+	float ExpectedIntervalMs = 0.0f;
+
+public:
+	/** Number of times the genlock was locked again after a loss */
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Relock")
+	int64 RelockCount = 0;
+
+	/** Time between the last genlock loss and the next lock */
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Relock")
+	float LastRelockTimeMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Relock")
+	float MaxRelockTimeMs = 0.0f;
+
+public:
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Interval")
+	float IntervalMinMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Interval")
+	float IntervalMeanMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Interval")
+	float IntervalMaxMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Interval")
+	float IntervalStdDevMs = 0.0f;
+
+public:
+	/** Offset between the genlock tick and the start of the engine frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Phase")
+	float PhaseMinMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Phase")
+	float PhaseMeanMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Phase")
+	float PhaseMaxMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Phase")
+	float PhaseStdDevMs = 0.0f;
+
+public:
+	/** Number of ticks per bin of deviation from the expected interval, the last bin holds all larger deviations */
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Jitter")
+	TArray<int32> JitterHistogram;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Genlock|Jitter")
+	float JitterHistogramBinWidthMs = 0.0f;
+
+public:
+	[[nodiscard]] FString ToString() const;
+};
+
+
 UCLASS(Blueprintable, EditInlineNew, meta = (DisplayName = "Deltcast Custom Timestep", MediaIOCustomLayout = "Deltacast"))
 class DELTACASTMEDIA_API UDeltacastCustomTimeStep : public UGenlockedCustomTimeStep,
                                                     public IDeltacastCustomTimeStepCallback
@@ -34,6 +107,22 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Genlock")
 	int32 BoardIndex = -1;
 
+	/**
+	 * Start the engine frame this amount of time before the predicted next genlock tick instead of waiting for the tick.
+	 * The prediction uses the measured tick period, the engine delta time remains the genlock period.
+	 * 0 waits for the tick.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Genlock", meta = (ClampMin = "0.0", Units = "ms"))
+	float EarlyReleaseOffsetMs = 0.0f;
+
+public:
+	/** Timing of the genlock ticks and of the engine frame start relative to them */
+	UFUNCTION(BlueprintPure, Category = "Genlock")
+	FDeltacastGenlockStatistics GetGenlockStatistics() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Genlock")
+	void ResetGenlockStatistics();
+
 public: //~ UFixedFrameRateCustomTimeStep
 	virtual bool Initialize(UEngine *InEngine) override;
 	virtual void Shutdown(UEngine *InEngine) override;
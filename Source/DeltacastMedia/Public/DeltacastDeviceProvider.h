@@ -17,10 +17,21 @@
 
 #include "CoreMinimal.h"
 #include "IMediaIOCoreDeviceProvider.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+
+class FDeltacastBoard;
+class FDeltacastDeviceMonitor;
+class FRunnableThread;
 
 
 class DELTACASTMEDIA_API FDeltacastDeviceProvider final : public IMediaIOCoreDeviceProvider
 {
+public:
+	FDeltacastDeviceProvider();
+	virtual ~FDeltacastDeviceProvider() override;
+
 public:
 	static FName GetProviderName();
 	static FName GetProtocolName();
@@ -49,34 +60,82 @@ public: //~ IMediaIOCoreDeviceProvider
 public:
 	TArray<FMediaIOConfiguration> GetOutputKeyConfigurations() const;
 
+private:
+	/** Everything exposed about one board, produced by a single scan of the board */
+	struct FBoardScan
+	{
+		TArray<FMediaIODevice>        Devices;
+		TArray<FMediaIOConnection>    Connections;
+		TArray<FMediaIOConfiguration> ConfigurationsInput;
+		TArray<FMediaIOConfiguration> ConfigurationsOutput;
+		TArray<FMediaIOConfiguration> ConfigurationsKeyOutput;
+		TArray<FMediaIOMode>          ModesInput;
+		TArray<FMediaIOMode>          ModesOutput;
+	};
+
+	/** Scans all the boards concurrently, the results are appended in board order */
+	[[nodiscard]] TArray<FBoardScan> ScanBoards() const;
+	[[nodiscard]] FBoardScan         ScanBoard(uint32 BoardIndex) const;
+
 private: //~ IMediaIOCoreDeviceProvider implementation without caching
-	TArray<FMediaIOConnection>                                           GetConnections_Impl() const;
-	TTuple<TArray<FMediaIOConfiguration>, TArray<FMediaIOConfiguration>> GetConfigurations_Impl(bool bAllowInput, bool bAllowOutput) const;
-	TArray<FMediaIOInputConfiguration>                                   GetInputConfigurations_Impl() const;
-	TArray<FMediaIOOutputConfiguration>                                  GetOutputConfigurations_Impl() const;
-	TArray<FMediaIOVideoTimecodeConfiguration>                           GetTimecodeConfigurations_Impl() const;
-	TArray<FMediaIODevice>                                               GetDevices_Impl() const;
-	TArray<FMediaIOMode>                                                 GetModes_Impl(bool bInOutput) const;
+	TArray<FMediaIOConnection>                 GetConnections_Impl(const FDeltacastBoard& Board) const;
+	void                                       GetConfigurations_Impl(const FDeltacastBoard& Board, FBoardScan& Scan) const;
+	TArray<FMediaIOInputConfiguration>         GetInputConfigurations_Impl(const TArray<FMediaIOConfiguration>& InputConfigurations) const;
+	TArray<FMediaIOOutputConfiguration>        GetOutputConfigurations_Impl(const TArray<FMediaIOConfiguration>& OutputConfigurations,
+	                                                                        const TArray<FMediaIOConfiguration>& OutputKeyConfigurations) const;
+	TArray<FMediaIOVideoTimecodeConfiguration> GetTimecodeConfigurations_Impl(const TArray<FMediaIOConfiguration>& InputConfigurations) const;
+	TArray<FMediaIOMode>                       GetModes_Impl(const FDeltacastBoard& Board, bool bInOutput) const;
+
+private:
+	/** Immutable result of an enumeration, replaced as a whole when the hardware changes */
+	struct FDeviceCache
+	{
+		TArray<uint64> HardwareIdentifier;
+
+		TArray<FMediaIOConnection>                 Connections;
+		TArray<FMediaIOConfiguration>              ConfigurationsInput;
+		TArray<FMediaIOConfiguration>              ConfigurationsOutput;
+		TArray<FMediaIOConfiguration>              ConfigurationsKeyOutput;
+		TArray<FMediaIOInputConfiguration>         InputConfigurations;
+		TArray<FMediaIOOutputConfiguration>        OutputConfigurations;
+		TArray<FMediaIOVideoTimecodeConfiguration> TimecodeConfigurations;
+		TArray<FMediaIODevice>                     Devices;
+		TArray<FMediaIOMode>                       ModesInput;
+		TArray<FMediaIOMode>                       ModesOutput;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	using FDeviceCacheRef = TSharedPtr<const FDeviceCache, ESPMode::ThreadSafe>;
 
 private:
 	friend class FDeltacastMediaModule;
 
+	/** Current snapshot, waits for the initial enumeration of the device monitor if it did not complete yet */
+	[[nodiscard]] FDeviceCacheRef GetCache() const;
+
+	/** Enumerates the devices and publishes a new snapshot if the hardware identifier changed */
 	void UpdateCache() const;
 
+	/** Reads the enumeration saved by a previous session if it was made with the same boards, SDK and plugin versions */
+	[[nodiscard]] static FDeviceCacheRef LoadPersistentCache(const TArray<uint64>& HardwareIdentifier);
+	/** Takes a copy as `Serialize` also loads, the shared snapshot is never written */
+	static void SavePersistentCache(FDeviceCache DeviceCache);
+
+	/** Starts the device monitor, the initial enumeration runs on its thread */
+	void StartDeviceMonitor();
+	void StopDeviceMonitor();
+
 	[[nodiscard]] static TArray<uint64> ComputeCurrentHardwareIdentifier();
 
 private:
-	mutable FCriticalSection CacheCriticalSection;
-	mutable TArray<uint64> CacheHardwareIdentifier;
-
-	mutable TArray<FMediaIOConnection>                 ConnectionsCache;
-	mutable TArray<FMediaIOConfiguration>              ConfigurationsInputCache;
-	mutable TArray<FMediaIOConfiguration>              ConfigurationsOutputCache;
-	mutable TArray<FMediaIOConfiguration>              ConfigurationsKeyOutputCache;
-	mutable TArray<FMediaIOInputConfiguration>         InputConfigurationsCache;
-	mutable TArray<FMediaIOOutputConfiguration>        OutputConfigurationsCache;
-	mutable TArray<FMediaIOVideoTimecodeConfiguration> TimecodeConfigurationsCache;
-	mutable TArray<FMediaIODevice>                     DevicesCache;
-	mutable TArray<FMediaIOMode>                       ModesInputCache;
-	mutable TArray<FMediaIOMode>                       ModesOutputCache;
+	/** Serializes the snapshot rebuilds, never taken by the getters */
+	mutable FCriticalSection CacheUpdateCriticalSection;
+
+	/** Only guards the copy of the snapshot pointer */
+	mutable FRWLock CacheLock;
+	mutable FDeviceCacheRef Cache;
+
+	TUniquePtr<FDeltacastDeviceMonitor> DeviceMonitor;
+	FRunnableThread* DeviceMonitorThread = nullptr;
 };
@@ -21,6 +21,7 @@
 
 #include <optional>
 
+class FDeltacastBoard;
 
 /**
  * Native data format.
@@ -41,7 +42,7 @@ namespace Deltacast::Device
 		class DELTACASTMEDIA_API FBasePortConfig
 		{
 		public:
-			[[nodiscard]] bool IsValid(VHDHandle BoardHandle) const;
+			[[nodiscard]] bool IsValid(const FDeltacastBoard& Board) const;
 
 			[[nodiscard]] FString ToString() const;
 
@@ -62,7 +63,7 @@ namespace Deltacast::Device
 		class DELTACASTMEDIA_API FSdiPortConfig
 		{
 		public:
-			[[nodiscard]] bool IsValid(VHDHandle BoardHandle) const;
+			[[nodiscard]] bool IsValid(const FDeltacastBoard& Board) const;
 
 			[[nodiscard]] FString ToString() const;
 
@@ -85,7 +86,7 @@ namespace Deltacast::Device
 		class DELTACASTMEDIA_API FDvPortConfig
 		{
 		public:
-			[[nodiscard]] bool IsValid(VHDHandle BoardHandle) const;
+			[[nodiscard]] bool IsValid(const FDeltacastBoard& Board) const;
 
 			[[nodiscard]] FString ToString() const;
 
@@ -100,7 +101,7 @@ namespace Deltacast::Device
 	class DELTACASTMEDIA_API FSdiConfigIterator
 	{
 	public:
-		explicit FSdiConfigIterator(const uint32 BoardIndex);
+		explicit FSdiConfigIterator(const uint32 BoardIndex, uint32 RxPortCount = VHD::MaxPortCount, uint32 TxPortCount = VHD::MaxPortCount);
 
 		FSdiConfigIterator end() const;
 
@@ -115,6 +116,9 @@ namespace Deltacast::Device
 	private:
 		uint32 BoardIndex = 0;
 
+		uint32 RxPortCount = VHD::MaxPortCount;
+		uint32 TxPortCount = VHD::MaxPortCount;
+
 		bool bIsInput = true;
 		uint32 PortIndex = 0;
 
@@ -139,17 +143,20 @@ namespace Deltacast::Device
 		FSdiConfigIterator end() const;
 
 	private:
-		explicit FSdiDeviceScanner(uint32 BoardIndex);
+		explicit FSdiDeviceScanner(uint32 BoardIndex, uint32 RxPortCount, uint32 TxPortCount);
 
 	private:
 		uint32 BoardIndex;
+
+		uint32 RxPortCount;
+		uint32 TxPortCount;
 	};
 
 
 	class DELTACASTMEDIA_API FDvConfigIterator
 	{
 	public:
-		explicit FDvConfigIterator(const uint32 BoardIndex);
+		explicit FDvConfigIterator(const uint32 BoardIndex, uint32 RxPortCount = VHD::MaxPortCount, uint32 TxPortCount = VHD::MaxPortCount);
 
 		FDvConfigIterator end() const;
 
@@ -164,6 +171,9 @@ namespace Deltacast::Device
 	private:
 		uint32 BoardIndex = 0;
 
+		uint32 RxPortCount = VHD::MaxPortCount;
+		uint32 TxPortCount = VHD::MaxPortCount;
+
 		bool bIsInput = true;
 		uint32 PortIndex = 0;
 
@@ -183,19 +193,22 @@ namespace Deltacast::Device
 	public:
 		FDvConfigIterator begin() const
 		{
-			return FDvConfigIterator(BoardIndex);
+			return FDvConfigIterator(BoardIndex, RxPortCount, TxPortCount);
 		}
 		
 		FDvConfigIterator end() const
 		{
-			return FDvConfigIterator(BoardIndex).end();
+			return FDvConfigIterator(BoardIndex, RxPortCount, TxPortCount).end();
 		}
 
 	private:
-		explicit FDvDeviceScanner(uint32 BoardIndex);
+		explicit FDvDeviceScanner(uint32 BoardIndex, uint32 RxPortCount, uint32 TxPortCount);
 
 	private:
 		uint32 BoardIndex;
+
+		uint32 RxPortCount;
+		uint32 TxPortCount;
 	};
 
 
@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "UObject/ObjectMacros.h"
+
+#include "DeltacastMediaColor.generated.h"
+
+
+/**
+ * Primaries and YUV matrix of the video signal.
+ */
+UENUM()
+enum class EDeltacastColorimetry : uint8
+{
+	/** On inputs Rec. 601 for the SD video modes and Rec. 709 otherwise, on outputs Rec. 709 as the engine conversions */
+	Auto,
+	Rec601 UMETA(DisplayName = "Rec. 601"),
+	Rec709 UMETA(DisplayName = "Rec. 709"),
+	Rec2020 UMETA(DisplayName = "Rec. 2020"),
+};
+
+/**
+ * Transfer function of the video signal.
+ */
+UENUM()
+enum class EDeltacastTransferFunction : uint8
+{
+	/** Standard dynamic range, the sRGB curve when a linear conversion is requested */
+	SDR UMETA(DisplayName = "SDR"),
+	/** SMPTE ST 2084 perceptual quantizer */
+	PQ UMETA(DisplayName = "PQ (ST 2084)"),
+	/** ARIB STD-B67 hybrid log-gamma */
+	HLG UMETA(DisplayName = "HLG"),
+};
@@ -46,6 +46,46 @@ enum class EDeltacastGenlockSource
 	RX11 = 11 UMETA(DisplayName = "RX 11"),
 };
 
+UENUM()
+enum class EDeltacastThreadPriority : uint8
+{
+	Normal UMETA(DisplayName = "Normal"),
+	AboveNormal UMETA(DisplayName = "Above normal"),
+	Highest UMETA(DisplayName = "Highest"),
+	TimeCritical UMETA(DisplayName = "Time critical"),
+};
+
+USTRUCT()
+struct DELTACASTMEDIA_API FDeltacastThreadSettings
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(config, EditAnywhere, Category = "Thread")
+	EDeltacastThreadPriority Priority = EDeltacastThreadPriority::Normal;
+
+	/**
+	 * Logical cores the thread may run on, one bit per core, 0 lets the scheduler choose
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Thread")
+	int64 AffinityMask = 0;
+
+	/**
+	 * Restrict the thread to the cores of the NUMA node of the board, see the board NUMA node setting
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Thread")
+	bool bPinToBoardNumaNode = false;
+
+	/**
+	 * Linux only, use the SCHED_FIFO real-time policy when the process is allowed to (CAP_SYS_NICE or RLIMIT_RTPRIO)
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Thread|Linux")
+	bool bUseRealTimeScheduling = false;
+
+	UPROPERTY(config, EditAnywhere, Category = "Thread|Linux", meta = (ClampMin = "1", ClampMax = "99", EditCondition = "bUseRealTimeScheduling"))
+	int32 RealTimePriority = 50;
+};
+
 USTRUCT()
 struct DELTACASTMEDIA_API FDeltacastBoardSettings
 {
@@ -71,6 +111,13 @@ public: // Timecode
 	*/
 	UPROPERTY(config, EditAnywhere, Category = "Timecode")
 	EDeltacastTimecodeSource TimecodeSource = EDeltacastTimecodeSource::OnBoard;
+
+public: // Threads
+	/**
+	 * NUMA node of the PCIe root complex the board is attached to, -1 when unknown
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Threads", meta = (ClampMin = "-1"))
+	int32 NumaNode = -1;
 };
 
 
@@ -83,7 +130,34 @@ public:
 	UPROPERTY(config, EditAnywhere, Category = "Boards", meta = (EditFixedOrder))
 	TArray<FDeltacastBoardSettings> BoardSettings;
 
+public: // Threads
+	/**
+	 * Media player capture threads
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Threads")
+	FDeltacastThreadSettings CaptureThread;
+
+	/**
+	 * Custom timestep genlock threads
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Threads")
+	FDeltacastThreadSettings TimeStepThread;
+
+	/**
+	 * Timecode provider threads
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Threads")
+	FDeltacastThreadSettings TimecodeThread;
+
+	/**
+	 * Media output threads queuing black frames on underruns, above normal by default as they must act within a frame
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Threads")
+	FDeltacastThreadSettings UnderrunFillerThread;
+
 public:
+	UDeltacastMediaSettings();
+
 	const FDeltacastBoardSettings *GetBoardSettings(int32 BoardIndex) const;
 
 #if WITH_EDITOR
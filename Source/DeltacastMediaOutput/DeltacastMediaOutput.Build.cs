@@ -40,6 +40,8 @@ public class DeltacastMediaOutput : ModuleRules
 			new string[]
 			{
 				"Core",
+				"DeltacastMedia",
+				"DeltacastMediaShaders",
 				"MediaIOCore",
 				"Renderer",
 				"RenderCore",
@@ -53,8 +55,8 @@ public class DeltacastMediaOutput : ModuleRules
 			new string[]
 			{
 				"CoreUObject",
-				"DeltacastMedia",
 				"Engine",
+				"MediaShaders",
 				"Projects",
 				"Slate",
 				"SlateCore",
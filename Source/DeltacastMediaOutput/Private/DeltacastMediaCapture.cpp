@@ -19,12 +19,18 @@
 #include "DeltacastHelpers.h"
 #include "DeltacastMediaEncodeTime.h"
 #include "DeltacastMediaOutput.h"
+#include "DeltacastMediaSettings.h"
 #include "DeltacastMediaShaders.h"
+#include "DeltacastOutputScheduler.h"
 #include "DeltacastSdk.h"
+#include "DeltacastThread.h"
+#include "DeltacastUnderrunFiller.h"
+#include "HAL/RunnableThread.h"
 #include "IDeltacastMediaModule.h"
 #include "IDeltacastMediaOutputModule.h"
 #include "MediaIOCoreEncodeTime.h"
 #include "MediaIOCoreFileWriter.h"
+#include "MediaShaders.h"
 #include "Misc/ScopeLock.h"
 #include "ScreenPass.h"
 #include "Slate/SceneViewport.h"
@@ -49,6 +55,10 @@ namespace DeltacastMediaCaptureUtils
 		{
 			case EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA:
 				return VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_32;
+			case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGB:
+				return VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30;
+			case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGBA:
+				return VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64;
 			case EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422:
 				return IsKeyEnabled ? VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUVK4224_10 : VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_10;
 			case EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422: [[fallthrough]];
@@ -96,6 +106,37 @@ namespace DeltacastMediaCaptureUtils
 				return {};
 		}
 	}
+
+	/** The preload cannot exceed the queue depth */
+	uint32 GetBufferPreLoad(const uint32 BufferDepth, const uint32 BufferPreLoad)
+	{
+		return FMath::Min(BufferPreLoad, BufferDepth);
+	}
+
+	/** Size in texels of the output texture of a frame of the given resolution packed in the pixel format of the output */
+	FIntPoint GetPackedSize(const UDeltacastMediaOutput *MediaOutput, const FIntPoint &Resolution)
+	{
+		const auto bIsKeyEnabled = MediaOutput->OutputConfiguration.OutputType == EMediaIOOutputType::FillAndKey;
+
+		switch (MediaOutput->PixelFormat)
+		{
+			case EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422:
+				return bIsKeyEnabled ? FIntPoint((Resolution.X * 3) / 4, Resolution.Y) : FIntPoint(Resolution.X / 2, Resolution.Y);
+			case EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422:
+				return bIsKeyEnabled ? FIntPoint(Resolution.X / 2, Resolution.Y) : FIntPoint(Align(Resolution.X, 48) / 6, Resolution.Y);
+			case EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA: [[fallthrough]];
+			case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGB: [[fallthrough]];
+			case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGBA: [[fallthrough]];
+			default:
+				return Resolution;
+		}
+	}
+
+	/** Size of the frame of the configuration as laid out for packing, the quad link sub images split on the GPU are stacked */
+	FIntPoint GetPrimaryLayoutSize(const UDeltacastMediaOutput *MediaOutput, const FIntPoint &Resolution)
+	{
+		return MediaOutput->IsQuadLinkSplitOnGpu() ? FIntPoint(Resolution.X / 2, Resolution.Y * 2) : Resolution;
+	}
 }
 
 
@@ -134,6 +175,9 @@ void UDeltacastMediaCapture::StopCaptureImpl(const bool bAllowPendingFrameToBePr
 {
 	if (!bAllowPendingFrameToBeProcess)
 	{
+		// The filler takes the rendering thread lock, it is stopped before
+		StopUnderrunFiller();
+
 		{
 			// Prevent the rendering thread from copying while we are stopping the capture.
 			FScopeLock ScopeLock(&RenderThreadCriticalSection);
@@ -146,6 +190,11 @@ void UDeltacastMediaCapture::StopCaptureImpl(const bool bAllowPendingFrameToBePr
 				[[maybe_unused]] const auto CloseStreamHandleResult = DeltacastSdk.CloseStreamHandle(StreamHandle);
 				StreamHandle                                        = VHD::InvalidHandle;
 
+				LastQueuedFrame.Rows.Empty();
+				OutputScheduler.Reset();
+
+				CloseAdditionalStreams();
+
 				const UDeltacastMediaOutput *DeltacastMediaSource = CastChecked<UDeltacastMediaOutput>(MediaOutput);
 				check(DeltacastMediaSource);
 
@@ -161,8 +210,8 @@ void UDeltacastMediaCapture::StopCaptureImpl(const bool bAllowPendingFrameToBePr
 
 				DeltacastSdk.SetLoopbackState(BoardHandle, PortIndex, LinkCount, VHD::True);
 
-				[[maybe_unused]] const auto CloseBoardHandleResult = DeltacastSdk.CloseBoardHandle(BoardHandle);
-				BoardHandle                                        = VHD::InvalidHandle;
+				BoardHandle = VHD::InvalidHandle;
+				Board.Reset();
 
 				ResetStatistics();
 			}
@@ -218,6 +267,7 @@ void UDeltacastMediaCapture::OnFrameCaptured_RenderingThread(const FCaptureBaseD
 		EMediaIOCoreEncodePixelFormat EncodePixelFormat = EMediaIOCoreEncodePixelFormat::CharBGRA;
 		EDeltacastEncodePixelFormat CustomEncodePixelFormat = EDeltacastEncodePixelFormat::YUVK4224_8bits;
 		bool UseCustomEncode = false;
+		bool CanEncodeTimecode = true;
 		FString OutputFilename;
 
 		switch (BufferPacking)
@@ -228,6 +278,19 @@ void UDeltacastMediaCapture::OnFrameCaptured_RenderingThread(const FCaptureBaseD
 				EncodePixelFormat = EMediaIOCoreEncodePixelFormat::CharBGRA;
 				OutputFilename = TEXT("Deltacast_Input_8_RGBA");
 				break;
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30:
+				Stride = Width * 4;
+				TimeEncodeWidth = Width;
+				EncodePixelFormat = EMediaIOCoreEncodePixelFormat::A2B10G10R10;
+				OutputFilename = TEXT("Deltacast_Input_10_RGB");
+				break;
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64:
+				// The timecode encoders have no 16-bit per component format
+				Stride = Width * 8;
+				TimeEncodeWidth = Width;
+				CanEncodeTimecode = false;
+				OutputFilename = TEXT("Deltacast_Input_10_RGBA");
+				break;
 			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8:
 				Stride = Width * 4;
 				TimeEncodeWidth = Width * 2;
@@ -257,26 +320,36 @@ void UDeltacastMediaCapture::OnFrameCaptured_RenderingThread(const FCaptureBaseD
 			default:
 				break;
 		}
+
+		// The rows of the secondary outputs follow the rows of the port of the configuration
+		const auto PrimaryHeight = PrimaryRowCount > 0 ? FMath::Min(Height, PrimaryRowCount) : Height;
 		
-		if (bEncodeTimecodeInTexel)
+		if (bEncodeTimecodeInTexel && CanEncodeTimecode)
 		{
 			const auto AlignedStride = Align(Stride, 256);
 			const auto& Timecode = InBaseData.SourceFrameTimecode;
 
 			if (!UseCustomEncode)
 			{
-				const FMediaIOCoreEncodeTime EncodeTime(EncodePixelFormat, InBuffer, AlignedStride, TimeEncodeWidth, Height);
+				const FMediaIOCoreEncodeTime EncodeTime(EncodePixelFormat, InBuffer, AlignedStride, TimeEncodeWidth, PrimaryHeight);
 				EncodeTime.Render(Timecode.Hours, Timecode.Minutes, Timecode.Seconds, Timecode.Frames);
 			}
 			else
 			{
-				const FDeltacastMediaEncodeTime EncodeTime(CustomEncodePixelFormat, InBuffer, AlignedStride, TimeEncodeWidth, Height);
+				const FDeltacastMediaEncodeTime EncodeTime(CustomEncodePixelFormat, InBuffer, AlignedStride, TimeEncodeWidth, PrimaryHeight);
 				EncodeTime.Render(Timecode.Hours, Timecode.Minutes, Timecode.Seconds, Timecode.Frames);
 			}
 		}
 
+		if (OutputScheduler.IsValid() && !ScheduleFrame(InBaseData))
+		{
+			UpdateStatistics();
+			return;
+		}
+
 		auto& DeltacastSdk = FDeltacast::GetSdk();
 
+		// The port of the configuration is locked first, the additional ports skip the frames it drops to stay aligned with it
 		VHDHandle  SlotHandle     = VHD::InvalidHandle;
 		const auto LockSlotResult = DeltacastSdk.LockSlotHandle(StreamHandle, &SlotHandle);
 		if (!Deltacast::Helpers::IsValid(LockSlotResult))
@@ -289,6 +362,7 @@ void UDeltacastMediaCapture::OnFrameCaptured_RenderingThread(const FCaptureBaseD
 				                      LockSlotResult == VHD_ERRORCODE::VHDERR_TIMEOUT;
 			
 			++AdjacentFrameDropped;
+			++DroppedFrameCount;
 
 			if (bShouldWarn)
 			{
@@ -302,46 +376,28 @@ void UDeltacastMediaCapture::OnFrameCaptured_RenderingThread(const FCaptureBaseD
 		AdjacentFrameDropped = 0;
 		LastFrameDroppedWarnedCount = 0;
 
+		// The read back frame is as wide as its widest output, the rows of the port of the configuration only span its own texels
+		const auto TexelSize     = Width > 0 ? Stride / Width : 0;
+		const auto PrimaryStride = PrimaryTexelWidth > 0 ? PrimaryTexelWidth * TexelSize : Stride;
+		QueueAdditionalFrames(EngineBuffer, PrimaryHeight, BytesPerRow, PrimaryStride, TexelSize);
+
 		VHD::ULONG BufferSize      = 0;
 		VHD::BYTE* Buffer          = nullptr;
 		const auto GetBufferResult = DeltacastSdk.GetSlotBuffer(SlotHandle, static_cast<VHD::ULONG>(VHD_SDI_BUFFERTYPE::VHD_SDI_BT_VIDEO), &Buffer,
 		                                                        &BufferSize);
 		if (Deltacast::Helpers::IsValid(GetBufferResult))
 		{
-			const auto EngineBufferSize = Height * BytesPerRow;
+			CopyToSlot(Buffer, BufferSize, bInterlaced, bFieldMergingSupported, EngineBuffer, PrimaryHeight, BytesPerRow, PrimaryStride);
 
-			if (bInterlaced && !bFieldMergingSupported)
+			if (OutputScheduler.IsValid())
 			{
-				check(Stride <= (uint32)BytesPerRow);
-
-				const auto C = Height / 2;
-				for (int Row = 0; Row < Height; Row += 2)
-				{
-					const auto SourceEvenLine = EngineBuffer + ((Row + 0) * BytesPerRow);
-					const auto SourceOddLine  = EngineBuffer + ((Row + 1) * BytesPerRow);
+				LastQueuedFrame.Rows.SetNumUninitialized(Height * BytesPerRow, EAllowShrinking::No);
+				std::memcpy(LastQueuedFrame.Rows.GetData(), EngineBuffer, LastQueuedFrame.Rows.Num());
 
-					const auto DestinationEvenLine = Buffer + (((Row / 2) + C) * Stride);
-					const auto DestinationOddLine  = Buffer + (((Row / 2) + 0) * Stride);
-
-					std::memcpy(DestinationEvenLine, SourceEvenLine, Stride);
-					std::memcpy(DestinationOddLine, SourceOddLine, Stride);
-				}
-			}
-			else
-			{
-				if (BufferSize != EngineBufferSize)
-				{
-					check(Stride <= (uint32)BytesPerRow);
-
-					for (int Row = 0; Row < Height; ++Row)
-					{
-						std::memcpy(Buffer + (Row * Stride), EngineBuffer + (Row * BytesPerRow), Stride);
-					}
-				}
-				else
-				{
-					std::memcpy(Buffer, EngineBuffer, BufferSize);
-				}
+				LastQueuedFrame.Height      = Height;
+				LastQueuedFrame.BytesPerRow = BytesPerRow;
+				LastQueuedFrame.Stride      = PrimaryStride;
+				LastQueuedFrame.TexelSize   = TexelSize;
 			}
 		}
 		else
@@ -351,8 +407,19 @@ void UDeltacastMediaCapture::OnFrameCaptured_RenderingThread(const FCaptureBaseD
 
 		[[maybe_unused]] const auto UnlockSlotResult = DeltacastSdk.UnlockSlotHandle(SlotHandle);
 
+		if (UnderrunFiller.IsValid())
+		{
+			UnderrunFiller->OnEngineFrameQueued();
+		}
+
 		UpdateStatistics();
 
+		if (BufferDepthController.has_value() && !UpdateBufferDepth())
+		{
+			SetState(EMediaCaptureState::Error);
+			return;
+		}
+
 
 		if (bDeltacastWriteInputRawDataCmdEnable)
 		{
@@ -370,70 +437,213 @@ void UDeltacastMediaCapture::OnFrameCaptured_RenderingThread(const FCaptureBaseD
 void UDeltacastMediaCapture::OnCustomCapture_RenderingThread(FRDGBuilder& GraphBuilder, const FCaptureBaseData& InBaseData, TSharedPtr<FMediaCaptureUserData, ESPMode::ThreadSafe> InUserData, FRDGTextureRef InSourceTexture, FRDGTextureRef OutputTexture, const FRHICopyTextureInfo& CopyInfo, FVector2D CropU, FVector2D CropV)
 {
 	const UDeltacastMediaOutput* const DeltacastOutput = CastChecked<UDeltacastMediaOutput>(MediaOutput);
-	switch (DeltacastOutput->PixelFormat)
+
+	const FIntRect ViewRect(CopyInfo.GetSourceRect());
+	const auto& Resolution = DeltacastOutput->OutputConfiguration.MediaConfiguration.MediaMode.Resolution;
+
+	FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	TShaderMapRef<FScreenPassVS> VertexShader(GlobalShaderMap);
+
+	const auto PrimaryLayoutSize = DeltacastMediaCaptureUtils::GetPrimaryLayoutSize(DeltacastOutput, Resolution);
+	const auto PrimaryPackedSize = DeltacastMediaCaptureUtils::GetPackedSize(DeltacastOutput, PrimaryLayoutSize);
+
+	if (DeltacastOutput->IsQuadLinkSplitOnGpu())
 	{
-	case EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422:
+		// The four link sub images are stacked then packed in a single pass, each link stream reads its rows
+		const auto SplitTextureDesc = FRDGTextureDesc::Create2D(PrimaryLayoutSize, InSourceTexture->Desc.Format, FClearValueBinding::None,
+		                                                        TexCreate_ShaderResource | TexCreate_RenderTargetable);
+		const auto SplitTexture = GraphBuilder.CreateTexture(SplitTextureDesc, TEXT("DeltacastQuadLinkSplit"));
+
+		const auto SplitMode = DeltacastOutput->OutputConfiguration.MediaConfiguration.MediaConnection.QuadTransportType == EMediaIOQuadLinkTransportType::TwoSampleInterleave
+			                       ? FDeltacastQuadLinkSplitPS::EMode::TwoSampleInterleaved
+			                       : FDeltacastQuadLinkSplitPS::EMode::Quadrant;
+
+		TShaderMapRef<FDeltacastQuadLinkSplitPS> SplitShader(GlobalShaderMap);
+		FDeltacastQuadLinkSplitPS::FParameters* SplitParameters = SplitShader->AllocateAndSetParameters(GraphBuilder, InSourceTexture, FIntRect(ViewRect.Min, ViewRect.Min + Resolution),
+		                                                                                                  SplitMode, SplitTexture);
+		AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("DeltacastQuadLinkSplit"), FScreenPassViewInfo(), FScreenPassTextureViewport(SplitTexture),
+		                  FScreenPassTextureViewport(InSourceTexture, ViewRect), VertexShader, SplitShader, SplitParameters);
+
+		AddPackingPass(GraphBuilder, SplitTexture, FIntRect(FIntPoint::ZeroValue, PrimaryLayoutSize), OutputTexture, FIntRect(FIntPoint::ZeroValue, PrimaryPackedSize),
+		               ERenderTargetLoadAction::ENoAction);
+	}
+	else
 	{
-		// Configure source/output viewport to get the right UV scaling from source texture to output texture
-		const FIntRect ViewRect(CopyInfo.GetSourceRect());
-		FScreenPassTextureViewport InputViewport(InSourceTexture, ViewRect);
-		FScreenPassTextureViewport OutputViewport(OutputTexture);
+		AddPackingPass(GraphBuilder, InSourceTexture, ViewRect, OutputTexture, FIntRect(FIntPoint::ZeroValue, PrimaryPackedSize), ERenderTargetLoadAction::ENoAction);
+	}
 
-		FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
-		TShaderMapRef<FRGBA8toYUVK4224ConvertPS> PixelShader(GlobalShaderMap);
-		TShaderMapRef<FScreenPassVS> VertexShader(GlobalShaderMap);
+	// Each secondary output is scaled from the source then packed below the previous one, the whole frame is read back once.
+	// The passes after the first one load the output texture to keep the rows already packed
+	TShaderMapRef<FCopyRectPS> ScaleShader(GlobalShaderMap);
 
-		const FMatrix& ConversionMatrix = GetRGBToYUVConversionMatrix();
-		const bool bDoLinearToSRGB = GetDesiredCaptureOptions().bApplyLinearToSRGBConversion;
-		FRGBA8toYUVK4224ConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InSourceTexture, ConversionMatrix, MediaShaders::YUVOffset8bits, bDoLinearToSRGB, OutputTexture);
-		AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("RGBA8ToYUVK"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
-		break;
-	}
-	case EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422:
+	int32 RowOffset = PrimaryPackedSize.Y;
+	for (const auto& Configuration : DeltacastOutput->SecondaryConfigurations)
 	{
-		// Configure source/output viewport to get the right UV scaling from source texture to output texture
-		const FIntRect ViewRect(CopyInfo.GetSourceRect());
-		FScreenPassTextureViewport InputViewport(InSourceTexture, ViewRect);
-		FScreenPassTextureViewport OutputViewport(OutputTexture);
+		const auto& SecondaryResolution = Configuration.MediaMode.Resolution;
 
-		FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
-		TShaderMapRef<FRGBA16toYUVK4224ConvertPS> PixelShader(GlobalShaderMap);
-		TShaderMapRef<FScreenPassVS> VertexShader(GlobalShaderMap);
+		const auto ScaledTextureDesc = FRDGTextureDesc::Create2D(SecondaryResolution, InSourceTexture->Desc.Format, FClearValueBinding::None,
+		                                                         TexCreate_ShaderResource | TexCreate_RenderTargetable);
+		const auto ScaledTexture = GraphBuilder.CreateTexture(ScaledTextureDesc, TEXT("DeltacastSecondaryOutput"));
 
-		const FMatrix& ConversionMatrix = GetRGBToYUVConversionMatrix();
-		const bool bDoLinearToSRGB = GetDesiredCaptureOptions().bApplyLinearToSRGBConversion;
-		FRGBA16toYUVK4224ConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InSourceTexture, ConversionMatrix, MediaShaders::YUVOffset10bits, bDoLinearToSRGB, OutputTexture);
-		AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("RGBA16ToYUVK"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
-		break;
+		FCopyRectPS::FParameters* ScaleParameters = GraphBuilder.AllocParameters<FCopyRectPS::FParameters>();
+		ScaleParameters->InputTexture     = InSourceTexture;
+		ScaleParameters->InputSampler     = TStaticSamplerState<SF_Bilinear>::GetRHI();
+		ScaleParameters->RenderTargets[0] = FRenderTargetBinding(ScaledTexture, ERenderTargetLoadAction::ENoAction);
+		AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("DeltacastScaleSecondaryOutput"), FScreenPassViewInfo(), FScreenPassTextureViewport(ScaledTexture),
+		                  FScreenPassTextureViewport(InSourceTexture, ViewRect), VertexShader, ScaleShader, ScaleParameters);
+
+		const auto PackedSize = DeltacastMediaCaptureUtils::GetPackedSize(DeltacastOutput, SecondaryResolution);
+		AddPackingPass(GraphBuilder, ScaledTexture, FIntRect(FIntPoint::ZeroValue, SecondaryResolution),
+		               OutputTexture, FIntRect(FIntPoint(0, RowOffset), FIntPoint(PackedSize.X, RowOffset + PackedSize.Y)), ERenderTargetLoadAction::ELoad);
+
+		RowOffset += PackedSize.Y;
 	}
-	}	
 }
 
 FIntPoint UDeltacastMediaCapture::GetCustomOutputSize(const FIntPoint& InSize) const
 {
 	const UDeltacastMediaOutput* const DeltacastOutput = CastChecked<UDeltacastMediaOutput>(MediaOutput);
+
+	auto OutputSize = DeltacastMediaCaptureUtils::GetPackedSize(DeltacastOutput, DeltacastMediaCaptureUtils::GetPrimaryLayoutSize(DeltacastOutput, InSize));
+
+	// The secondary outputs are packed below the port of the configuration
+	for (const auto& Configuration : DeltacastOutput->SecondaryConfigurations)
+	{
+		const auto PackedSize = DeltacastMediaCaptureUtils::GetPackedSize(DeltacastOutput, Configuration.MediaMode.Resolution);
+
+		OutputSize.X  = FMath::Max(OutputSize.X, PackedSize.X);
+		OutputSize.Y += PackedSize.Y;
+	}
+
+	return OutputSize;
+}
+
+EPixelFormat UDeltacastMediaCapture::GetCustomOutputPixelFormat(const EPixelFormat& InPixelFormat) const
+{
+	const UDeltacastMediaOutput* const DeltacastOutput = CastChecked<UDeltacastMediaOutput>(MediaOutput);
+	const auto bIsKeyEnabled = DeltacastOutput->OutputConfiguration.OutputType == EMediaIOOutputType::FillAndKey;
+
 	switch (DeltacastOutput->PixelFormat)
 	{
 	case EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422:
-		return FIntPoint((InSize.X * 3) / 4, InSize.Y);
+		return bIsKeyEnabled || DeltacastOutput->IsColorConvertedByCapture() ? PF_R32_UINT : PF_B8G8R8A8;
 	case EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422:
-		return FIntPoint(InSize.X / 2, InSize.Y);
+		return bIsKeyEnabled ? PF_R32G32_UINT : PF_R32G32B32A32_UINT;
 	default:
-		return InSize;
+		return InPixelFormat;
 	}
 }
 
-EPixelFormat UDeltacastMediaCapture::GetCustomOutputPixelFormat(const EPixelFormat& InPixelFormat) const
+const FMatrix& UDeltacastMediaCapture::GetRGBToYUVConversionMatrix() const
 {
 	const UDeltacastMediaOutput* const DeltacastOutput = CastChecked<UDeltacastMediaOutput>(MediaOutput);
+
+	switch (DeltacastOutput->Colorimetry)
+	{
+	case EDeltacastColorimetry::Rec601:
+		return DeltacastMediaShaders::RgbToYuvRec601Scaled;
+	case EDeltacastColorimetry::Rec2020:
+		return DeltacastMediaShaders::RgbToYuvRec2020Scaled;
+	case EDeltacastColorimetry::Auto: [[fallthrough]];
+	case EDeltacastColorimetry::Rec709: [[fallthrough]];
+	default:
+		return Super::GetRGBToYUVConversionMatrix();
+	}
+}
+
+FDeltacastColorConversion UDeltacastMediaCapture::GetColorConversion() const
+{
+	const UDeltacastMediaOutput* const DeltacastOutput = CastChecked<UDeltacastMediaOutput>(MediaOutput);
+
+	auto ColorConversion = FDeltacastColorConversion::Make(DeltacastOutput->TransferFunction, DeltacastOutput->HdrReferenceWhiteNits,
+	                                                       GetDesiredCaptureOptions().bApplyLinearToSRGBConversion);
+
+	if (DeltacastOutput->Colorimetry == EDeltacastColorimetry::Rec2020)
+	{
+		ColorConversion.Gamut = DeltacastMediaShaders::Rec709ToRec2020;
+	}
+
+	return ColorConversion;
+}
+
+void UDeltacastMediaCapture::AddPackingPass(FRDGBuilder& GraphBuilder, FRDGTextureRef InputTexture, const FIntRect& InputRect, FRDGTextureRef OutputTexture, const FIntRect& OutputRect,
+                                            const ERenderTargetLoadAction LoadAction) const
+{
+	const UDeltacastMediaOutput* const DeltacastOutput = CastChecked<UDeltacastMediaOutput>(MediaOutput);
+	const auto bIsKeyEnabled = DeltacastOutput->OutputConfiguration.OutputType == EMediaIOOutputType::FillAndKey;
+
+	// Configure source/output viewport to get the right UV scaling from source texture to output texture
+	const FScreenPassTextureViewport InputViewport(InputTexture, InputRect);
+	const FScreenPassTextureViewport OutputViewport(OutputTexture, OutputRect);
+
+	FGlobalShaderMap* GlobalShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+	TShaderMapRef<FScreenPassVS> VertexShader(GlobalShaderMap);
+
+	const FMatrix& ConversionMatrix = GetRGBToYUVConversionMatrix();
+	const bool bDoLinearToSRGB = GetDesiredCaptureOptions().bApplyLinearToSRGBConversion;
+	const auto ColorConversion = GetColorConversion();
+
 	switch (DeltacastOutput->PixelFormat)
 	{
 	case EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422:
-		return PF_R32_UINT;
+	{
+		if (bIsKeyEnabled)
+		{
+			TShaderMapRef<FRGBA8toYUVK4224ConvertPS> PixelShader(GlobalShaderMap);
+			FRGBA8toYUVK4224ConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InputTexture, ConversionMatrix, MediaShaders::YUVOffset8bits, ColorConversion, OutputTexture, LoadAction);
+			AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("RGBA8ToYUVK"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
+		}
+		else if (DeltacastOutput->IsColorConvertedByCapture())
+		{
+			TShaderMapRef<FDeltacastRGBtoUYVYConvertPS> PixelShader(GlobalShaderMap);
+			FDeltacastRGBtoUYVYConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InputTexture, ConversionMatrix, MediaShaders::YUVOffset8bits, ColorConversion, OutputTexture, LoadAction);
+			AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("DeltacastRGBToUYVY"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
+		}
+		else
+		{
+			TShaderMapRef<FRGB8toUYVY8ConvertPS> PixelShader(GlobalShaderMap);
+			FRGB8toUYVY8ConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InputTexture, ConversionMatrix, MediaShaders::YUVOffset8bits, bDoLinearToSRGB, OutputTexture);
+			Parameters->RenderTargets[0] = FRenderTargetBinding(OutputTexture, LoadAction);
+			AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("RGB8ToUYVY"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
+		}
+		break;
+	}
 	case EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422:
-		return PF_R32G32_UINT;
+	{
+		if (bIsKeyEnabled)
+		{
+			TShaderMapRef<FRGBA16toYUVK4224ConvertPS> PixelShader(GlobalShaderMap);
+			FRGBA16toYUVK4224ConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InputTexture, ConversionMatrix, MediaShaders::YUVOffset10bits, ColorConversion, OutputTexture, LoadAction);
+			AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("RGBA16ToYUVK"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
+		}
+		else if (DeltacastOutput->IsColorConvertedByCapture())
+		{
+			TShaderMapRef<FDeltacastRGBtoV210ConvertPS> PixelShader(GlobalShaderMap);
+			FDeltacastRGBtoV210ConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InputTexture, ConversionMatrix, MediaShaders::YUVOffset10bits, ColorConversion, OutputTexture, LoadAction);
+			AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("DeltacastRGBToYUVv210"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
+		}
+		else
+		{
+			TShaderMapRef<FRGB10toYUVv210ConvertPS> PixelShader(GlobalShaderMap);
+			FRGB10toYUVv210ConvertPS::FParameters* Parameters = PixelShader->AllocateAndSetParameters(GraphBuilder, InputTexture, ConversionMatrix, MediaShaders::YUVOffset10bits, bDoLinearToSRGB, OutputTexture);
+			Parameters->RenderTargets[0] = FRenderTargetBinding(OutputTexture, LoadAction);
+			AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("RGB10ToYUVv210"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
+		}
+		break;
+	}
+	case EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA: [[fallthrough]];
+	case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGB: [[fallthrough]];
+	case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGBA: [[fallthrough]];
 	default:
-		return InPixelFormat;
+	{
+		TShaderMapRef<FCopyRectPS> PixelShader(GlobalShaderMap);
+		FCopyRectPS::FParameters* Parameters = GraphBuilder.AllocParameters<FCopyRectPS::FParameters>();
+		Parameters->InputTexture     = InputTexture;
+		Parameters->InputSampler     = TStaticSamplerState<SF_Point>::GetRHI();
+		Parameters->RenderTargets[0] = FRenderTargetBinding(OutputTexture, LoadAction);
+		AddDrawScreenPass(GraphBuilder, RDG_EVENT_NAME("RGBACopy"), FScreenPassViewInfo(), OutputViewport, InputViewport, VertexShader, PixelShader, Parameters);
+		break;
+	}
 	}
 }
 
@@ -452,6 +662,16 @@ bool UDeltacastMediaCapture::Initialize(const UDeltacastMediaOutput *InMediaOutp
 		return false;
 	}
 
+	// Without a linear conversion the SDR frames are encoded as they are, their primaries cannot be converted
+	if (InMediaOutput->Colorimetry == EDeltacastColorimetry::Rec2020 && InMediaOutput->TransferFunction == EDeltacastTransferFunction::SDR &&
+	    !GetDesiredCaptureOptions().bApplyLinearToSRGBConversion)
+	{
+		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("The MediaOutput '%s' needs the linear to sRGB conversion of the capture options to send Rec. 2020 SDR frames."),
+		       *InMediaOutput->GetName());
+		SetState(EMediaCaptureState::Error);
+		return false;
+	}
+
 	bEncodeTimecodeInTexel = InMediaOutput->bEncodeTimecodeInTexel;
 
 	auto& DeltacastSdk = FDeltacast::GetSdk();
@@ -465,9 +685,14 @@ bool UDeltacastMediaCapture::Initialize(const UDeltacastMediaOutput *InMediaOutp
 	const auto bIsEuropeanClock      = Deltacast::Helpers::IsDeviceModeIdentifierEuropeanClock(DeviceModeIdentifier);
 	const auto bIsSdiMode            = Deltacast::Helpers::IsDeviceModeIdentifierSdi(DeviceModeIdentifier);
 	const auto bIsDvMode             = Deltacast::Helpers::IsDeviceModeIdentifierDv(DeviceModeIdentifier);
-	const auto SdiVideoStandard      = bIsSdiMode
+	const auto FrameVideoStandard    = bIsSdiMode
 		                                   ? Deltacast::Helpers::GetSdiVideoStandardFromDeviceModeIdentifier(DeviceModeIdentifier)
 		                                   : VHD_VIDEOSTANDARD::NB_VHD_VIDEOSTANDARDS;
+	// Each link of a quad link frame split on the GPU is a single link stream of the sub image video standard
+	const auto bIsQuadLinkSplit      = InMediaOutput->IsQuadLinkSplitOnGpu();
+	const auto SdiVideoStandard      = bIsQuadLinkSplit
+		                                   ? Deltacast::Helpers::GetQuadLinkSubImageVideoStandard(FrameVideoStandard).value_or(VHD_VIDEOSTANDARD::NB_VHD_VIDEOSTANDARDS)
+		                                   : FrameVideoStandard;
 	const auto DvVideoStandard = bIsDvMode
 		                             ? Deltacast::Helpers::GetDvVideoStandardFromDeviceModeIdentifier(DeviceModeIdentifier)
 		                             : VHD_DV_HDMI_VIDEOSTANDARD::NB_VHD_DV_HDMI_VIDEOSTD;
@@ -475,11 +700,16 @@ bool UDeltacastMediaCapture::Initialize(const UDeltacastMediaOutput *InMediaOutp
 
 	bInterlaced = InMediaOutput->OutputConfiguration.MediaConfiguration.MediaMode.Standard != EMediaIOStandardType::Progressive;
 	const auto TransportType = InMediaOutput->OutputConfiguration.MediaConfiguration.MediaConnection.TransportType;
-	const auto QuadTransportType = InMediaOutput->OutputConfiguration.MediaConfiguration.MediaConnection.QuadTransportType;
 	const auto IsKeyEnabled = InMediaOutput->OutputConfiguration.OutputType == EMediaIOOutputType::FillAndKey;
 	BufferPacking = DeltacastMediaCaptureUtils::GetBufferPackingFromPixelFormat(InMediaOutput->PixelFormat, IsKeyEnabled);
-	const auto BufferDepth = InMediaOutput->NumberOfDeltacastBuffers;
-	const auto BufferPreLoad = BufferDepth / 2;
+	const auto MaximumBufferDepth = static_cast<uint32>(InMediaOutput->NumberOfDeltacastBuffers);
+	BufferDepth = InMediaOutput->bAdaptiveBufferDepth
+		              ? static_cast<uint32>(FMath::Clamp(InMediaOutput->MinimumNumberOfDeltacastBuffers, 2, InMediaOutput->NumberOfDeltacastBuffers))
+		              : MaximumBufferDepth;
+	BufferPreLoad = static_cast<uint32>(InMediaOutput->NumberOfPreloadedBuffers);
+	DroppedFrameCount = 0;
+	PaddedFrameCount  = 0;
+	LastQueuedFrame   = {};
 	const auto LinkCount = TransportType == EMediaIOTransportType::SingleLink ||
 	                       TransportType == EMediaIOTransportType::HDMI
 		                       ? 1
@@ -496,15 +726,16 @@ bool UDeltacastMediaCapture::Initialize(const UDeltacastMediaOutput *InMediaOutp
 		return false;
 	}
 
-	const auto bRequireLinePadding = Deltacast::Helpers::RequiresLinePadding(VideoCharacteristics->Width);
+	FrameLineCount  = VideoCharacteristics->Height;
+	OutputFrameRate = bIsEuropeanClock ? FFrameRate(VideoCharacteristics->FrameRate, 1) : FFrameRate(VideoCharacteristics->FrameRate * 1000, 1001);
 
 	// Clean up because StopCapture() is not called on error during initialization
 	const auto BoardCleanUp = [&DeltacastSdk, bIsSdiMode, PortIndex, LinkCount, this]()
 	{
 		DeltacastSdk.SetLoopbackState(BoardHandle, PortIndex, LinkCount, VHD::True);
 
-		[[maybe_unused]] const auto Result = DeltacastSdk.CloseBoardHandle(BoardHandle);
-		BoardHandle                        = VHD::InvalidHandle;
+		BoardHandle = VHD::InvalidHandle;
+		Board.Reset();
 	};
 	const auto StreamCleanUp = [&DeltacastSdk, this]()
 	{
@@ -512,14 +743,16 @@ bool UDeltacastMediaCapture::Initialize(const UDeltacastMediaOutput *InMediaOutp
 		StreamHandle                       = VHD::InvalidHandle;
 	};
 
-	BoardHandle = DeltacastSdk.OpenBoard(BoardIndex).value_or(VHD::InvalidHandle);
-	if (BoardHandle == VHD::InvalidHandle)
+	Board = FDeltacast::GetBoardRegistry().Acquire(BoardIndex);
+	if (!Board.IsValid())
 	{
 		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to open Deltacast board with index %lu."), BoardIndex);
 		SetState(EMediaCaptureState::Error);
 		return false;
 	}
 
+	BoardHandle = Board->GetHandle();
+
 	const auto StreamType = Deltacast::Helpers::GetStreamTypeFromPortIndex(false, PortIndex);
 
 	DeltacastSdk.SetLoopbackState(BoardHandle, PortIndex, LinkCount, VHD::False);
@@ -548,78 +781,189 @@ bool UDeltacastMediaCapture::Initialize(const UDeltacastMediaOutput *InMediaOutp
 		return false;
 	}
 
-	if (bIsSdiMode)
+	FStreamSettings StreamSettings;
+	StreamSettings.bIsSdiMode           = bIsSdiMode;
+	StreamSettings.bIsDvMode            = bIsDvMode;
+	StreamSettings.bIsEuropeanClock     = bIsEuropeanClock;
+	StreamSettings.bIsKeyerEnabled      = bIsKeyerEnabled;
+	StreamSettings.bIsGenlocked         = bIsGenlocked;
+	StreamSettings.bIsInterlaced        = bInterlaced;
+	StreamSettings.SdiVideoStandard     = SdiVideoStandard;
+	StreamSettings.DvVideoStandard      = DvVideoStandard;
+	StreamSettings.VideoCharacteristics = VideoCharacteristics.value();
+	StreamSettings.BufferDepth          = BufferDepth;
+	StreamSettings.IOTimeout            = static_cast<VHD::ULONG>(InMediaOutput->SlotLockTimeoutMs);
+
+	auto StreamConnection = InMediaOutput->OutputConfiguration.MediaConfiguration.MediaConnection;
+	if (bIsQuadLinkSplit)
 	{
-		const auto Interface = DeltacastMediaCaptureUtils::GetInterface(TransportType, bIsKeyerEnabled, QuadTransportType, SdiVideoStandard);
-		if (!Interface.has_value())
-		{
-			BoardCleanUp();
-			StreamCleanUp();
-			SetState(EMediaCaptureState::Error);
-			return false;
-		}
+		StreamConnection.TransportType = EMediaIOTransportType::SingleLink;
+	}
 
-		[[maybe_unused]] const auto SetVideoStandardResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_SDI_STREAMPROPERTY::VHD_SDI_SP_VIDEO_STANDARD, static_cast<VHD::ULONG>(SdiVideoStandard));
-		[[maybe_unused]] const auto SetInterfaceResult     = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_SDI_STREAMPROPERTY::VHD_SDI_SP_INTERFACE, static_cast<VHD::ULONG>(Interface.value()));
+	if (!ConfigureStream(StreamHandle, *Board, StreamConnection, StreamSettings, bFieldMergingSupported))
+	{
+		BoardCleanUp();
+		StreamCleanUp();
+		SetState(EMediaCaptureState::Error);
+		return false;
 	}
 
-	if (bIsDvMode)
+	const auto StartStreamResult = DeltacastSdk.StartStream(StreamHandle);
+	if (!Deltacast::Helpers::IsValid(StartStreamResult))
 	{
-		[[maybe_unused]] const auto SetModeResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_MODE, static_cast<VHD::ULONG>(VHD_DV_MODE::VHD_DV_MODE_HDMI));
+		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to start stream with error: %s."), *Deltacast::Helpers::GetErrorString(StartStreamResult));
+		SetState(EMediaCaptureState::Error);
 
-		const auto FrameRate = bIsEuropeanClock ? VideoCharacteristics->FrameRate : VideoCharacteristics->FrameRate - 1;
+		StreamCleanUp();
+		BoardCleanUp();
 
-		[[maybe_unused]] const auto PresetResult = DeltacastSdk.PresetTimingStreamProperties(StreamHandle, VHD_DV_STANDARD::VHD_DV_STD_SMPTE, VideoCharacteristics->Width, VideoCharacteristics->Height, FrameRate, VideoCharacteristics->bIsInterlaced);
+		return false;
+	}
 
-		Deltacast::Helpers::FCablePacking CablePacking(BufferPacking, bIsSd);
+	const auto AdditionalStreamCleanUp = [&DeltacastSdk, &StreamCleanUp, &BoardCleanUp, this]()
+	{
+		CloseAdditionalStreams();
 
-		[[maybe_unused]] const auto SetColorSpaceResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_CS, static_cast<VHD::ULONG>(CablePacking.ColorSpace));
-		[[maybe_unused]] const auto SetSamplingResult   = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_CABLE_BIT_SAMPLING, static_cast<VHD::ULONG>(CablePacking.Sampling));
-	}
+		[[maybe_unused]] const auto StopStreamResult = DeltacastSdk.StopStream(StreamHandle);
+		StreamCleanUp();
+		BoardCleanUp();
+	};
 
-	/* Configure stream video standard */
-	[[maybe_unused]] const auto SetBufferQueueDepthResult   = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_DEPTH, BufferDepth);
-	[[maybe_unused]] const auto SetBufferQueuePreLoadResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_PRELOAD, BufferPreLoad);
-	[[maybe_unused]] const auto SetIOTimeoutResult          = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_IO_TIMEOUT, 0);
-	[[maybe_unused]] const auto SetBufferPackingResult      = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFER_PACKING, static_cast<VHD::ULONG>(BufferPacking));
+	const auto& Resolution = InMediaOutput->OutputConfiguration.MediaConfiguration.MediaMode.Resolution;
+
+	PrimaryRowCount   = bIsQuadLinkSplit ? Resolution.Y / 2 : Resolution.Y;
+	PrimaryTexelWidth = DeltacastMediaCaptureUtils::GetPackedSize(InMediaOutput, DeltacastMediaCaptureUtils::GetPrimaryLayoutSize(InMediaOutput, Resolution)).X;
 
-	if (bIsGenlocked)
+	// The links 2 to 4 of a quad link frame split on the GPU follow the first one in the read back frame, on the next ports
+	if (bIsQuadLinkSplit)
 	{
-		[[maybe_unused]] const auto SetGenlockResult = DeltacastSdk.SetStreamProperty(StreamHandle,
-		                                                                              VHD_SDI_STREAMPROPERTY::VHD_SDI_SP_TX_GENLOCK, VHD::True);
+		const auto LinkPackedSize = DeltacastMediaCaptureUtils::GetPackedSize(InMediaOutput, FIntPoint(Resolution.X / 2, PrimaryRowCount));
+
+		for (int32 Link = 1; Link < 4; ++Link)
+		{
+			auto LinkConnection = StreamConnection;
+			LinkConnection.PortIdentifier += Link;
+
+			auto& LinkStream = AdditionalStreams.AddDefaulted_GetRef();
+			LinkStream.bIsInterlaced = bInterlaced;
+			LinkStream.RowOffset     = Link * LinkPackedSize.Y;
+			LinkStream.RowCount      = LinkPackedSize.Y;
+			LinkStream.TexelWidth    = LinkPackedSize.X;
+
+			if (!OpenAdditionalStream(LinkConnection, StreamSettings, LinkStream))
+			{
+				SetState(EMediaCaptureState::Error);
+				AdditionalStreamCleanUp();
+				return false;
+			}
+		}
 	}
 
-	if (bRequireLinePadding)
+	// The additional ports keep the largest depth as they do not adapt
+	StreamSettings.BufferDepth = MaximumBufferDepth;
+
+	for (const auto& Connection : InMediaOutput->MirrorConnections)
 	{
-		[[maybe_unused]] const auto SetLinePaddingResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_LINE_PADDING, 128);
+		// Added first so that a failure closes it with the others
+		auto& MirrorStream = AdditionalStreams.AddDefaulted_GetRef();
+		MirrorStream.bIsInterlaced = bInterlaced;
+
+		if (!OpenAdditionalStream(Connection, StreamSettings, MirrorStream))
+		{
+			SetState(EMediaCaptureState::Error);
+			AdditionalStreamCleanUp();
+			return false;
+		}
 	}
 
-	if (bInterlaced)
+	// The secondary outputs share the pixel format, output type and reference of the port of the configuration
+	auto SecondaryRowOffset = DeltacastMediaCaptureUtils::GetPackedSize(InMediaOutput, DeltacastMediaCaptureUtils::GetPrimaryLayoutSize(InMediaOutput, Resolution)).Y;
+	for (const auto& Configuration : InMediaOutput->SecondaryConfigurations)
 	{
-		bFieldMergingSupported = DeltacastSdk.IsFieldMergingSupported(BoardHandle).value_or(false);
+		const auto SecondaryDeviceModeIdentifier = Configuration.MediaMode.DeviceModeIdentifier;
+
+		auto SecondarySettings = StreamSettings;
+		SecondarySettings.bIsSdiMode       = Deltacast::Helpers::IsDeviceModeIdentifierSdi(SecondaryDeviceModeIdentifier);
+		SecondarySettings.bIsDvMode        = Deltacast::Helpers::IsDeviceModeIdentifierDv(SecondaryDeviceModeIdentifier);
+		SecondarySettings.bIsEuropeanClock = Deltacast::Helpers::IsDeviceModeIdentifierEuropeanClock(SecondaryDeviceModeIdentifier);
+		SecondarySettings.bIsGenlocked     = SecondarySettings.bIsSdiMode && InMediaOutput->OutputConfiguration.OutputReference != EMediaIOReferenceType::FreeRun;
+		SecondarySettings.bIsInterlaced    = Configuration.MediaMode.Standard != EMediaIOStandardType::Progressive;
+		SecondarySettings.SdiVideoStandard = SecondarySettings.bIsSdiMode
+			                                     ? Deltacast::Helpers::GetSdiVideoStandardFromDeviceModeIdentifier(SecondaryDeviceModeIdentifier)
+			                                     : VHD_VIDEOSTANDARD::NB_VHD_VIDEOSTANDARDS;
+		SecondarySettings.DvVideoStandard  = SecondarySettings.bIsDvMode
+			                                     ? Deltacast::Helpers::GetDvVideoStandardFromDeviceModeIdentifier(SecondaryDeviceModeIdentifier)
+			                                     : VHD_DV_HDMI_VIDEOSTANDARD::NB_VHD_DV_HDMI_VIDEOSTD;
+
+		const auto SecondaryVideoCharacteristics = SecondarySettings.bIsSdiMode
+			                                           ? Deltacast::Helpers::GetVideoCharacteristics(SecondarySettings.SdiVideoStandard)
+			                                           : Deltacast::Helpers::GetVideoCharacteristics(SecondarySettings.DvVideoStandard);
+		if (!SecondaryVideoCharacteristics.has_value())
+		{
+			UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to get video standard characteristics of secondary output on port %d"),
+			       Configuration.MediaConnection.PortIdentifier);
+			SetState(EMediaCaptureState::Error);
+			AdditionalStreamCleanUp();
+			return false;
+		}
+
+		SecondarySettings.VideoCharacteristics = SecondaryVideoCharacteristics.value();
+
+		const auto PackedSize = DeltacastMediaCaptureUtils::GetPackedSize(InMediaOutput, Configuration.MediaMode.Resolution);
+
+		auto& SecondaryStream = AdditionalStreams.AddDefaulted_GetRef();
+		SecondaryStream.bIsInterlaced = SecondarySettings.bIsInterlaced;
+		SecondaryStream.RowOffset     = SecondaryRowOffset;
+		SecondaryStream.RowCount      = PackedSize.Y;
+		SecondaryStream.TexelWidth    = PackedSize.X;
+
+		SecondaryRowOffset += PackedSize.Y;
+
+		if (!OpenAdditionalStream(Configuration.MediaConnection, SecondarySettings, SecondaryStream))
+		{
+			SetState(EMediaCaptureState::Error);
+			AdditionalStreamCleanUp();
+			return false;
+		}
+	}
 
-	 	if (bFieldMergingSupported)
-	 	{
-	 		const auto SetLinePaddingResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_FIELD_MERGE, VHD::True);
-	 		if (!Deltacast::Helpers::IsValid(SetLinePaddingResult))
-	 		{
-		        UE_LOG(LogDeltacastMediaOutput, Warning, TEXT("Failed to set field merging stream property: %s"),
-		               *Deltacast::Helpers::GetErrorString(SetLinePaddingResult));
-	 			bFieldMergingSupported = false;
-	 		}
-	 	}
+	BufferDepthController.reset();
+	if (InMediaOutput->bAdaptiveBufferDepth)
+	{
+		FDeltacastBufferDepthController::FConfig ControllerConfig;
+		ControllerConfig.MinimumDepth = BufferDepth;
+		ControllerConfig.MaximumDepth = FMath::Max(MaximumBufferDepth, BufferDepth);
+		ControllerConfig.bIsInput     = false;
+
+		BufferDepthController.emplace(ControllerConfig);
+
+		BufferDepthStatistics.bUpdateProcessedFrameCount = false;
+		BufferDepthStatistics.bUpdateDroppedFrameCount   = true;
+		BufferDepthStatistics.bUpdateBufferFill          = true;
+		BufferDepthStatistics.NumberOfDeltacastBuffers   = BufferDepth;
+		BufferDepthStatistics.Reset();
 	}
 
-	const auto StartStreamResult = DeltacastSdk.StartStream(StreamHandle);
-	if (!Deltacast::Helpers::IsValid(StartStreamResult))
+	OutputScheduler.Reset();
+	if (InMediaOutput->Scheduling == EDeltacastOutputScheduling::Timecode)
 	{
-		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to start stream with error: %s."), *Deltacast::Helpers::GetErrorString(StartStreamResult));
-		SetState(EMediaCaptureState::Error);
+		FDeltacastOutputScheduler::FConfig SchedulerConfig;
+		SchedulerConfig.bDropLateFrames   = InMediaOutput->LateFramePolicy == EDeltacastLateFramePolicy::Drop;
+		SchedulerConfig.MaximumCorrection = static_cast<uint32>(InMediaOutput->MaximumScheduleCorrection);
 
-		StreamCleanUp();
-		BoardCleanUp();
+		OutputScheduler = MakeShared<FDeltacastOutputScheduler>(SchedulerConfig);
+	}
 
-		return false;
+	if (InMediaOutput->UnderrunPolicy == EDeltacastOutputUnderrunPolicy::InsertBlack)
+	{
+		const auto FramePeriod = OutputFrameRate.AsInterval();
+		if (!StartUnderrunFiller(FramePeriod, FrameLineCount))
+		{
+			UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to start the underrun filler thread of output '%s'."), *InMediaOutput->GetName());
+			SetState(EMediaCaptureState::Error);
+			AdditionalStreamCleanUp();
+			return false;
+		}
 	}
 
 	SetState(EMediaCaptureState::Capturing);
@@ -643,7 +987,7 @@ void UDeltacastMediaCapture::UpdateStatistics() const
 	Statistics.DroppedFrameCount          = static_cast<uint32>(DeltacastMediaSource->RepeatedFrameCount);
 	Statistics.BufferFill                 = DeltacastMediaSource->BufferFill;
 
-	Statistics.NumberOfDeltacastBuffers   = static_cast<uint32>(DeltacastMediaSource->NumberOfDeltacastBuffers);
+	Statistics.NumberOfDeltacastBuffers   = BufferDepth;
 
 
 	Deltacast::Helpers::GetStreamStatistics(Statistics, StreamHandle);
@@ -656,7 +1000,19 @@ void UDeltacastMediaCapture::UpdateStatistics() const
 
 	if (Statistics.bUpdateDroppedFrameCount)
 	{
-		DeltacastMediaSource->RepeatedFrameCount = static_cast<int32>(Statistics.DroppedFrameCount);
+		// Black and padding frames replace the repeats the board would otherwise have sent
+		const auto InsertedBlackFrameCount = UnderrunFiller.IsValid() ? UnderrunFiller->GetInsertedFrameCount() : 0;
+
+		DeltacastMediaSource->RepeatedFrameCount      = static_cast<int32>(Statistics.DroppedFrameCount + InsertedBlackFrameCount + PaddedFrameCount);
+		DeltacastMediaSource->InsertedBlackFrameCount = static_cast<int32>(InsertedBlackFrameCount);
+		auto TotalDroppedFrameCount = DroppedFrameCount;
+		for (const auto& AdditionalStream : AdditionalStreams)
+		{
+			TotalDroppedFrameCount += AdditionalStream.DroppedFrameCount;
+		}
+
+		DeltacastMediaSource->DroppedFrameCount       = static_cast<int32>(TotalDroppedFrameCount);
+		DeltacastMediaSource->LateFrameCount          = OutputScheduler.IsValid() ? static_cast<int32>(OutputScheduler->GetLateFrameCount()) : 0;
 	}
 
 	if (Statistics.bUpdateBufferFill)
@@ -677,6 +1033,411 @@ void UDeltacastMediaCapture::ResetStatistics() const
 	DeltacastMediaSource->ProcessedFrameCount = static_cast<int32>(Statistics.ProcessedFrameCount);
 	DeltacastMediaSource->RepeatedFrameCount   = static_cast<int32>(Statistics.DroppedFrameCount);
 	DeltacastMediaSource->BufferFill          = Statistics.BufferFill;
+
+	DeltacastMediaSource->InsertedBlackFrameCount = 0;
+	DeltacastMediaSource->DroppedFrameCount       = 0;
+	DeltacastMediaSource->LateFrameCount          = 0;
+}
+
+
+bool UDeltacastMediaCapture::UpdateBufferDepth()
+{
+	Deltacast::Helpers::GetStreamStatistics(BufferDepthStatistics, StreamHandle);
+
+	const auto Adjustment = BufferDepthController->Update(BufferDepthStatistics.DroppedFrameCount, BufferDepthStatistics.FilledSlotCount, FPlatformTime::Seconds());
+	if (!Adjustment.has_value())
+	{
+		return true;
+	}
+
+	UE_LOG(LogDeltacastMediaOutput, Display, TEXT("Changing the buffer depth of output '%s' from %u to %u: %s"),
+	       *MediaOutput->GetName(), Adjustment->PreviousDepth, Adjustment->Depth, Adjustment->Reason);
+
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	// The queue depth and preload are only taken into account when the stream starts
+	[[maybe_unused]] const auto StopStreamResult = DeltacastSdk.StopStream(StreamHandle);
+
+	const auto SetBufferQueueDepthResult   = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_DEPTH, Adjustment->Depth);
+	const auto SetBufferQueuePreLoadResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_PRELOAD,
+	                                                                        DeltacastMediaCaptureUtils::GetBufferPreLoad(Adjustment->Depth, BufferPreLoad));
+	UE_CLOG(!Deltacast::Helpers::IsValid(SetBufferQueueDepthResult) || !Deltacast::Helpers::IsValid(SetBufferQueuePreLoadResult), LogDeltacastMediaOutput, Warning,
+	        TEXT("Failed to set the buffer depth of output '%s': %s/%s"), *MediaOutput->GetName(),
+	        *Deltacast::Helpers::GetErrorString(SetBufferQueueDepthResult), *Deltacast::Helpers::GetErrorString(SetBufferQueuePreLoadResult));
+
+	const auto StartStreamResult = DeltacastSdk.StartStream(StreamHandle);
+	if (!Deltacast::Helpers::IsValid(StartStreamResult))
+	{
+		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to restart the stream of output '%s': %s"), *MediaOutput->GetName(), *Deltacast::Helpers::GetErrorString(StartStreamResult));
+		return false;
+	}
+
+	BufferDepth = Adjustment->Depth;
+
+	// The output ticks restart with the stream
+	if (OutputScheduler.IsValid())
+	{
+		OutputScheduler->Reset();
+	}
+	if (UnderrunFiller.IsValid())
+	{
+		UnderrunFiller->OnStreamRestarted();
+	}
+
+	BufferDepthStatistics.Reset();
+	BufferDepthStatistics.NumberOfDeltacastBuffers = BufferDepth;
+
+	return true;
+}
+
+
+bool UDeltacastMediaCapture::ConfigureStream(const VHDHandle InStreamHandle, const FDeltacastBoard &InBoard, const FMediaIOConnection &Connection,
+                                             const FStreamSettings &Settings, bool &bOutFieldMergingSupported) const
+{
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	const auto& VideoCharacteristics = Settings.VideoCharacteristics;
+
+	if (Settings.bIsSdiMode)
+	{
+		const auto Interface = DeltacastMediaCaptureUtils::GetInterface(Connection.TransportType, Settings.bIsKeyerEnabled, Connection.QuadTransportType, Settings.SdiVideoStandard);
+		if (!Interface.has_value())
+		{
+			return false;
+		}
+
+		[[maybe_unused]] const auto SetVideoStandardResult = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_SDI_STREAMPROPERTY::VHD_SDI_SP_VIDEO_STANDARD, static_cast<VHD::ULONG>(Settings.SdiVideoStandard));
+		[[maybe_unused]] const auto SetInterfaceResult     = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_SDI_STREAMPROPERTY::VHD_SDI_SP_INTERFACE, static_cast<VHD::ULONG>(Interface.value()));
+	}
+
+	if (Settings.bIsDvMode)
+	{
+		[[maybe_unused]] const auto SetModeResult = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_MODE, static_cast<VHD::ULONG>(VHD_DV_MODE::VHD_DV_MODE_HDMI));
+
+		const auto FrameRate = Settings.bIsEuropeanClock ? VideoCharacteristics.FrameRate : VideoCharacteristics.FrameRate - 1;
+
+		[[maybe_unused]] const auto PresetResult = DeltacastSdk.PresetTimingStreamProperties(InStreamHandle, VHD_DV_STANDARD::VHD_DV_STD_SMPTE, VideoCharacteristics.Width, VideoCharacteristics.Height, FrameRate, VideoCharacteristics.bIsInterlaced);
+
+		Deltacast::Helpers::FCablePacking CablePacking(BufferPacking, Deltacast::Helpers::IsSd(Settings.DvVideoStandard),
+		                                               CastChecked<UDeltacastMediaOutput>(MediaOutput)->Colorimetry);
+
+		[[maybe_unused]] const auto SetColorSpaceResult = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_CS, static_cast<VHD::ULONG>(CablePacking.ColorSpace));
+		[[maybe_unused]] const auto SetSamplingResult   = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_CABLE_BIT_SAMPLING, static_cast<VHD::ULONG>(CablePacking.Sampling));
+	}
+
+	/* Configure stream video standard */
+	[[maybe_unused]] const auto SetBufferQueueDepthResult   = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_DEPTH, Settings.BufferDepth);
+	[[maybe_unused]] const auto SetBufferQueuePreLoadResult = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_PRELOAD,
+	                                                                                         DeltacastMediaCaptureUtils::GetBufferPreLoad(Settings.BufferDepth, BufferPreLoad));
+	[[maybe_unused]] const auto SetIOTimeoutResult          = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_IO_TIMEOUT, Settings.IOTimeout);
+	[[maybe_unused]] const auto SetBufferPackingResult      = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFER_PACKING, static_cast<VHD::ULONG>(BufferPacking));
+
+	if (Settings.bIsGenlocked)
+	{
+		[[maybe_unused]] const auto SetGenlockResult = DeltacastSdk.SetStreamProperty(InStreamHandle,
+		                                                                              VHD_SDI_STREAMPROPERTY::VHD_SDI_SP_TX_GENLOCK, VHD::True);
+	}
+
+	if (Deltacast::Helpers::RequiresLinePadding(VideoCharacteristics.Width))
+	{
+		[[maybe_unused]] const auto SetLinePaddingResult = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_LINE_PADDING, 128);
+	}
+
+	bOutFieldMergingSupported = false;
+
+	if (Settings.bIsInterlaced)
+	{
+		bOutFieldMergingSupported = InBoard.GetInfo().bIsFieldMergingSupported;
+
+		if (bOutFieldMergingSupported)
+		{
+			const auto SetFieldMergeResult = DeltacastSdk.SetStreamProperty(InStreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_FIELD_MERGE, VHD::True);
+			if (!Deltacast::Helpers::IsValid(SetFieldMergeResult))
+			{
+				UE_LOG(LogDeltacastMediaOutput, Warning, TEXT("Failed to set field merging stream property: %s"),
+				       *Deltacast::Helpers::GetErrorString(SetFieldMergeResult));
+				bOutFieldMergingSupported = false;
+			}
+		}
+	}
+
+	return true;
+}
+
+
+bool UDeltacastMediaCapture::OpenAdditionalStream(const FMediaIOConnection &Connection, const FStreamSettings &Settings, FAdditionalStream &Stream) const
+{
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	const auto BoardIndex = static_cast<VHD::ULONG>(Connection.Device.DeviceIdentifier);
+
+	Stream.PortIndex = Connection.PortIdentifier;
+	Stream.LinkCount = Connection.TransportType == EMediaIOTransportType::SingleLink ||
+	                   Connection.TransportType == EMediaIOTransportType::HDMI
+		                   ? 1
+		                   : 4;
+
+	Stream.Board = FDeltacast::GetBoardRegistry().Acquire(BoardIndex);
+	if (!Stream.Board.IsValid())
+	{
+		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to open Deltacast board with index %lu for an additional port."), BoardIndex);
+		return false;
+	}
+
+	const auto AdditionalBoardHandle = Stream.Board->GetHandle();
+	const auto StreamType            = Deltacast::Helpers::GetStreamTypeFromPortIndex(false, Stream.PortIndex);
+
+	DeltacastSdk.SetLoopbackState(AdditionalBoardHandle, Stream.PortIndex, Stream.LinkCount, VHD::False);
+
+	if (Settings.bIsSdiMode)
+	{
+		const auto ClockDivisor = Settings.bIsEuropeanClock ? VHD_CLOCKDIVISOR::VHD_CLOCKDIV_1 : VHD_CLOCKDIVISOR::VHD_CLOCKDIV_1001;
+
+		[[maybe_unused]] const auto SetClockDivisorResult = DeltacastSdk.SetBoardProperty(AdditionalBoardHandle, VHD_SDI_BOARDPROPERTY::VHD_SDI_BP_CLOCK_SYSTEM, static_cast<VHD::ULONG>(ClockDivisor));
+
+		Stream.StreamHandle = DeltacastSdk.OpenStream(AdditionalBoardHandle, StreamType, VHD_SDI_STREAMPROCMODE::VHD_SDI_STPROC_DISJOINED_VIDEO).value_or(VHD::InvalidHandle);
+	}
+
+	if (Settings.bIsDvMode)
+	{
+		Stream.StreamHandle = DeltacastSdk.OpenStream(AdditionalBoardHandle, StreamType, VHD_DV_STREAMPROCMODE::VHD_DV_STPROC_DISJOINED_VIDEO).value_or(VHD::InvalidHandle);
+	}
+
+	if (Stream.StreamHandle == VHD::InvalidHandle)
+	{
+		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to open the stream of additional port %d on board %u."), Stream.PortIndex, BoardIndex);
+		return false;
+	}
+
+	if (!ConfigureStream(Stream.StreamHandle, *Stream.Board, Connection, Settings, Stream.bFieldMergingSupported))
+	{
+		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("The connection of additional port %d on board %u is not supported."), Stream.PortIndex, BoardIndex);
+		return false;
+	}
+
+	const auto StartStreamResult = DeltacastSdk.StartStream(Stream.StreamHandle);
+	if (!Deltacast::Helpers::IsValid(StartStreamResult))
+	{
+		UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed to start the stream of additional port %d on board %u: %s."), Stream.PortIndex, BoardIndex,
+		       *Deltacast::Helpers::GetErrorString(StartStreamResult));
+		return false;
+	}
+
+	return true;
+}
+
+void UDeltacastMediaCapture::CloseAdditionalStreams()
+{
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	for (auto& AdditionalStream : AdditionalStreams)
+	{
+		if (AdditionalStream.StreamHandle != VHD::InvalidHandle)
+		{
+			[[maybe_unused]] const auto StopStreamResult        = DeltacastSdk.StopStream(AdditionalStream.StreamHandle);
+			[[maybe_unused]] const auto CloseStreamHandleResult = DeltacastSdk.CloseStreamHandle(AdditionalStream.StreamHandle);
+		}
+
+		if (AdditionalStream.Board.IsValid())
+		{
+			DeltacastSdk.SetLoopbackState(AdditionalStream.Board->GetHandle(), AdditionalStream.PortIndex, AdditionalStream.LinkCount, VHD::True);
+		}
+	}
+
+	AdditionalStreams.Reset();
+	PrimaryRowCount   = 0;
+	PrimaryTexelWidth = 0;
+}
+
+
+void UDeltacastMediaCapture::QueueAdditionalFrames(const VHD::BYTE *EngineBuffer, const int32 PrimaryHeight, const int32 BytesPerRow, const uint32 Stride, const uint32 TexelSize)
+{
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	for (auto& AdditionalStream : AdditionalStreams)
+	{
+		VHDHandle  AdditionalSlotHandle     = VHD::InvalidHandle;
+		const auto AdditionalLockSlotResult = DeltacastSdk.LockSlotHandle(AdditionalStream.StreamHandle, &AdditionalSlotHandle);
+		if (!Deltacast::Helpers::IsValid(AdditionalLockSlotResult))
+		{
+			UE_CLOG(AdditionalLockSlotResult != VHD_ERRORCODE::VHDERR_TIMEOUT, LogDeltacastMediaOutput, Error,
+			        TEXT("Failed to lock slot of additional port %d: %s"), AdditionalStream.PortIndex, *Deltacast::Helpers::GetErrorString(AdditionalLockSlotResult));
+			++AdditionalStream.DroppedFrameCount;
+			continue;
+		}
+
+		VHD::ULONG AdditionalBufferSize      = 0;
+		VHD::BYTE* AdditionalBuffer          = nullptr;
+		const auto GetAdditionalBufferResult = DeltacastSdk.GetSlotBuffer(AdditionalSlotHandle, static_cast<VHD::ULONG>(VHD_SDI_BUFFERTYPE::VHD_SDI_BT_VIDEO), &AdditionalBuffer,
+		                                                                  &AdditionalBufferSize);
+		if (Deltacast::Helpers::IsValid(GetAdditionalBufferResult))
+		{
+			const auto RowCount  = AdditionalStream.RowCount > 0 ? AdditionalStream.RowCount : PrimaryHeight;
+			const auto RowStride = AdditionalStream.TexelWidth > 0 ? AdditionalStream.TexelWidth * TexelSize : Stride;
+
+			CopyToSlot(AdditionalBuffer, AdditionalBufferSize, AdditionalStream.bIsInterlaced, AdditionalStream.bFieldMergingSupported,
+			           EngineBuffer + (AdditionalStream.RowOffset * BytesPerRow), RowCount, BytesPerRow, RowStride);
+		}
+		else
+		{
+			UE_LOG(LogDeltacastMediaOutput, Error, TEXT("Failed get the slot buffer of additional port %d: %s"), AdditionalStream.PortIndex,
+			       *Deltacast::Helpers::GetErrorString(GetAdditionalBufferResult));
+		}
+
+		[[maybe_unused]] const auto UnlockAdditionalSlotResult = DeltacastSdk.UnlockSlotHandle(AdditionalSlotHandle);
+	}
+}
+
+void UDeltacastMediaCapture::CopyToSlot(VHD::BYTE *Buffer, const VHD::ULONG BufferSize, const bool bIsInterlacedStream, const bool bIsFieldMerged,
+                                        const VHD::BYTE *EngineBuffer, const int32 Height, const int32 BytesPerRow, const uint32 Stride) const
+{
+	const auto EngineBufferSize = static_cast<VHD::ULONG>(Height * BytesPerRow);
+
+	if (bIsInterlacedStream && !bIsFieldMerged)
+	{
+		check(Stride <= (uint32)BytesPerRow);
+
+		const auto C = Height / 2;
+		for (int Row = 0; Row < Height; Row += 2)
+		{
+			const auto SourceEvenLine = EngineBuffer + ((Row + 0) * BytesPerRow);
+			const auto SourceOddLine  = EngineBuffer + ((Row + 1) * BytesPerRow);
+
+			const auto DestinationEvenLine = Buffer + (((Row / 2) + C) * Stride);
+			const auto DestinationOddLine  = Buffer + (((Row / 2) + 0) * Stride);
+
+			std::memcpy(DestinationEvenLine, SourceEvenLine, Stride);
+			std::memcpy(DestinationOddLine, SourceOddLine, Stride);
+		}
+	}
+	else
+	{
+		if (BufferSize != EngineBufferSize)
+		{
+			check(Stride <= (uint32)BytesPerRow);
+
+			for (int Row = 0; Row < Height; ++Row)
+			{
+				std::memcpy(Buffer + (Row * Stride), EngineBuffer + (Row * BytesPerRow), Stride);
+			}
+		}
+		else
+		{
+			std::memcpy(Buffer, EngineBuffer, BufferSize);
+		}
+	}
+}
+
+
+bool UDeltacastMediaCapture::StartUnderrunFiller(const double FramePeriod, const uint32 LineCount)
+{
+	check(!UnderrunFiller.IsValid());
+	check(UnderrunFillerThread == nullptr);
+
+	FDeltacastUnderrunFillerConfig Config;
+	Config.StreamCriticalSection = &RenderThreadCriticalSection;
+	Config.StreamHandle          = StreamHandle;
+	Config.BufferPacking         = BufferPacking;
+	Config.LineCount             = LineCount;
+	Config.FramePeriod           = FramePeriod;
+
+	const UDeltacastMediaOutput* const DeltacastOutput = CastChecked<UDeltacastMediaOutput>(MediaOutput);
+	const auto BoardIndex = DeltacastOutput->OutputConfiguration.MediaConfiguration.MediaConnection.Device.DeviceIdentifier;
+
+	UnderrunFiller       = MakeShared<FDeltacastUnderrunFiller, ESPMode::ThreadSafe>(Config);
+	UnderrunFillerThread = Deltacast::Thread::Create(UnderrunFiller.Get(), *FString::Printf(TEXT("Deltacast Underrun Filler %s"), *MediaOutput->GetName()),
+	                                                 GetDefault<UDeltacastMediaSettings>()->UnderrunFillerThread, BoardIndex);
+	if (UnderrunFillerThread == nullptr)
+	{
+		UnderrunFiller.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void UDeltacastMediaCapture::StopUnderrunFiller()
+{
+	if (UnderrunFillerThread != nullptr)
+	{
+		UnderrunFillerThread->Kill(true);
+		delete UnderrunFillerThread;
+		UnderrunFillerThread = nullptr;
+	}
+
+	UnderrunFiller.Reset();
+}
+
+
+bool UDeltacastMediaCapture::ScheduleFrame(const FCaptureBaseData &InBaseData)
+{
+	const auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	const auto SentFrameCount     = DeltacastSdk.GetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_SLOTS_COUNT);
+	const auto RepeatedFrameCount = DeltacastSdk.GetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_SLOTS_DROPPED);
+	const auto FilledSlotCount    = DeltacastSdk.GetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_FILLING);
+	if (!SentFrameCount.has_value() || !RepeatedFrameCount.has_value() || !FilledSlotCount.has_value())
+	{
+		// The frame is queued immediately when the stream position is unknown
+		return true;
+	}
+
+	// On each output frame the board sends a queued slot or repeats the last one
+	const auto NextPresentationTick = uint64{ SentFrameCount.value() } + RepeatedFrameCount.value() + FilledSlotCount.value();
+	const auto FreeSlotCount        = BufferDepth > FilledSlotCount.value() ? BufferDepth - FilledSlotCount.value() : 0;
+
+	const auto& SourceFrameRate = InBaseData.SourceFrameTimecodeFramerate;
+	const auto  SourceFrame     = InBaseData.SourceFrameTimecode.ToFrameNumber(SourceFrameRate);
+	const auto  FrameNumber     = FFrameRate::TransformTime(FFrameTime(SourceFrame), SourceFrameRate, OutputFrameRate).RoundToFrame().Value;
+
+	const auto Decision = OutputScheduler->Schedule(FrameNumber, NextPresentationTick, FreeSlotCount);
+
+	for (uint32 PaddingIndex = 0; PaddingIndex < Decision.PaddingFrameCount; ++PaddingIndex)
+	{
+		if (!QueuePaddingFrame())
+		{
+			break;
+		}
+
+		++PaddedFrameCount;
+	}
+
+	return Decision.bShouldQueue;
+}
+
+bool UDeltacastMediaCapture::QueuePaddingFrame()
+{
+	if (LastQueuedFrame.Rows.IsEmpty())
+	{
+		return false;
+	}
+
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	VHDHandle  SlotHandle     = VHD::InvalidHandle;
+	const auto LockSlotResult = DeltacastSdk.LockSlotHandle(StreamHandle, &SlotHandle);
+	if (!Deltacast::Helpers::IsValid(LockSlotResult))
+	{
+		return false;
+	}
+
+	const auto& Frame         = LastQueuedFrame;
+	const auto  PrimaryHeight = PrimaryRowCount > 0 ? FMath::Min(Frame.Height, PrimaryRowCount) : Frame.Height;
+
+	// The additional ports are padded along so that they keep sending the frames on the ticks of the port of the configuration
+	QueueAdditionalFrames(Frame.Rows.GetData(), PrimaryHeight, Frame.BytesPerRow, Frame.Stride, Frame.TexelSize);
+
+	VHD::ULONG BufferSize      = 0;
+	VHD::BYTE* Buffer          = nullptr;
+	const auto GetBufferResult = DeltacastSdk.GetSlotBuffer(SlotHandle, static_cast<VHD::ULONG>(VHD_SDI_BUFFERTYPE::VHD_SDI_BT_VIDEO), &Buffer, &BufferSize);
+	if (Deltacast::Helpers::IsValid(GetBufferResult))
+	{
+		CopyToSlot(Buffer, BufferSize, bInterlaced, bFieldMergingSupported, Frame.Rows.GetData(), PrimaryHeight, Frame.BytesPerRow, Frame.Stride);
+	}
+
+	[[maybe_unused]] const auto UnlockSlotResult = DeltacastSdk.UnlockSlotHandle(SlotHandle);
+
+	return Deltacast::Helpers::IsValid(GetBufferResult);
 }
 
 
@@ -15,6 +15,7 @@
 
 #include "DeltacastMediaOutput.h"
 
+#include "DeltacastBoardRegistry.h"
 #include "DeltacastDeviceScanner.h"
 #include "DeltacastHelpers.h"
 #include "DeltacastMediaCapture.h"
@@ -29,9 +30,29 @@
 #define LOCTEXT_NAMESPACE "DeltacastMediaOutput"
 
 
+bool IsPixelFormatRgb(const EDeltacastMediaOutputPixelFormat PixelFormat)
+{
+	return PixelFormat == EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA ||
+	       PixelFormat == EDeltacastMediaOutputPixelFormat::PF_10BIT_RGB ||
+	       PixelFormat == EDeltacastMediaOutputPixelFormat::PF_10BIT_RGBA;
+}
+
 bool IsPixelFormatSupportedSdi(const EDeltacastMediaOutputPixelFormat PixelFormat)
 {
-	return PixelFormat != EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA;
+	return !IsPixelFormatRgb(PixelFormat);
+}
+
+bool IsPixelFormatSupportedByBoard(const EDeltacastMediaOutputPixelFormat PixelFormat, const FDeltacastBoardInfo& BoardInfo)
+{
+	switch (PixelFormat)
+	{
+	case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGB:
+		return BoardInfo.bIsRgb10Supported;
+	case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGBA:
+		return BoardInfo.bIsRgba10Supported;
+	default:
+		return true;
+	}
 }
 
 
@@ -72,6 +93,88 @@ bool UDeltacastMediaOutput::Validate(FString& OutFailureReason) const
 		return false;
 	}
 
+	for (int32 MirrorIndex = 0; MirrorIndex < MirrorConnections.Num(); ++MirrorIndex)
+	{
+		const auto& MirrorConnection = MirrorConnections[MirrorIndex];
+
+		const auto MirrorBoardIndex = static_cast<VHD::ULONG>(MirrorConnection.Device.DeviceIdentifier);
+		if (!DeltacastSdk.IsBoardIndexValid(MirrorBoardIndex).value_or(false))
+		{
+			OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' mirrors to the board index '%d' that doesn't exist on this machine."), *GetName(), MirrorConnection.Device.DeviceIdentifier);
+			return false;
+		}
+
+		if (MirrorBoardIndex == BoardIndex && MirrorConnection.PortIdentifier == OutputConfiguration.MediaConfiguration.MediaConnection.PortIdentifier)
+		{
+			OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' mirrors to the port of its configuration."), *GetName());
+			return false;
+		}
+
+		for (int32 OtherIndex = 0; OtherIndex < MirrorIndex; ++OtherIndex)
+		{
+			const auto& OtherConnection = MirrorConnections[OtherIndex];
+			if (OtherConnection.Device.DeviceIdentifier == MirrorConnection.Device.DeviceIdentifier && OtherConnection.PortIdentifier == MirrorConnection.PortIdentifier)
+			{
+				OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' mirrors twice to the port %d of the board index '%d'."), *GetName(),
+				                                   MirrorConnection.PortIdentifier, MirrorConnection.Device.DeviceIdentifier);
+				return false;
+			}
+		}
+	}
+
+	// The stream restarts and the black frames only drive the stream of the configuration, the additional ports would drift from it
+	if (!MirrorConnections.IsEmpty() && (bAdaptiveBufferDepth || UnderrunPolicy == EDeltacastOutputUnderrunPolicy::InsertBlack))
+	{
+		OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' cannot mirror ports with an adaptive buffer depth or black underrun frames."), *GetName());
+		return false;
+	}
+	if (!SecondaryConfigurations.IsEmpty() && (bAdaptiveBufferDepth || UnderrunPolicy == EDeltacastOutputUnderrunPolicy::InsertBlack))
+	{
+		OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' cannot have secondary outputs with an adaptive buffer depth or black underrun frames."), *GetName());
+		return false;
+	}
+
+	// Each output anchors its schedule on its own stream, a restarted stream or a delayed schedule would stay out of phase with the other outputs
+	if (Scheduling == EDeltacastOutputScheduling::Timecode && (LateFramePolicy == EDeltacastLateFramePolicy::Delay || bAdaptiveBufferDepth))
+	{
+		OutFailureReason = FString::Printf(TEXT("The timecode scheduling of '%s' cannot delay the late frames or adapt the buffer depth."), *GetName());
+		return false;
+	}
+
+	if (IsColorConvertedByCapture() && IsPixelFormatRgb(PixelFormat))
+	{
+		OutFailureReason = FString::Printf(TEXT("The transfer function and colorimetry of '%s' need a YUV pixel format."), *GetName());
+		return false;
+	}
+
+	const auto& MediaMode = OutputConfiguration.MediaConfiguration.MediaMode;
+	for (const auto& Configuration : SecondaryConfigurations)
+	{
+		if (!Configuration.IsValid())
+		{
+			OutFailureReason = FString::Printf(TEXT("A secondary configuration of '%s' is invalid."), *GetName());
+			return false;
+		}
+
+		if (!DeltacastSdk.IsBoardIndexValid(static_cast<VHD::ULONG>(Configuration.MediaConnection.Device.DeviceIdentifier)).value_or(false))
+		{
+			OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' has a secondary output on the board index '%d' that doesn't exist on this machine."), *GetName(), Configuration.MediaConnection.Device.DeviceIdentifier);
+			return false;
+		}
+
+		if (Configuration.MediaMode.FrameRate != MediaMode.FrameRate)
+		{
+			OutFailureReason = FString::Printf(TEXT("The secondary output on port %d of '%s' does not have the frame rate of the configuration."), Configuration.MediaConnection.PortIdentifier, *GetName());
+			return false;
+		}
+
+		if (Configuration.MediaMode.Resolution.X > MediaMode.Resolution.X)
+		{
+			OutFailureReason = FString::Printf(TEXT("The secondary output on port %d of '%s' is wider than the configuration."), Configuration.MediaConnection.PortIdentifier, *GetName());
+			return false;
+		}
+	}
+
 	const auto DeviceModeIdentifier = OutputConfiguration.MediaConfiguration.MediaMode.DeviceModeIdentifier;
 
 	const auto bIsSdi = Deltacast::Helpers::IsDeviceModeIdentifierSdi(DeviceModeIdentifier);
@@ -116,16 +219,56 @@ bool UDeltacastMediaOutput::Validate(FString& OutFailureReason) const
 					return Deltacast::Helpers::GetQuadLinkInterface(VideoStandard, QuadLinkType, IsDual);
 			}();
 
-		const auto BoardHandle = DeltacastSdk.OpenBoard(PortConfig.Base.BoardIndex).value_or(VHD::InvalidHandle);
-		if (!BoardHandle)
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(PortConfig.Base.BoardIndex);
+		if (!Board.IsValid())
 		{
 			OutFailureReason = FString::Printf(TEXT("Failed to validate Deltacast media source because board handle cannot be obtained"));
 			return false;
 		}
 
-		const auto bIsValid = PortConfig.IsValid(BoardHandle);
+		if (IsQuadLinkSplitOnGpu())
+		{
+			if (!MirrorConnections.IsEmpty())
+			{
+				OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' cannot split quad link frames with mirror ports."), *GetName());
+				return false;
+			}
+
+			// The links are independent streams, the stream restarts, the black frames and the schedule would only drive the first one
+			if (bAdaptiveBufferDepth || UnderrunPolicy == EDeltacastOutputUnderrunPolicy::InsertBlack || Scheduling == EDeltacastOutputScheduling::Timecode)
+			{
+				OutFailureReason = FString::Printf(TEXT("The MediaOutput '%s' cannot split quad link frames with an adaptive buffer depth, black underrun frames or timecode scheduling."), *GetName());
+				return false;
+			}
+
+			const auto SubImageVideoStandard = Deltacast::Helpers::GetQuadLinkSubImageVideoStandard(VideoStandard);
+			if (!SubImageVideoStandard.has_value())
+			{
+				OutFailureReason = FString::Printf(TEXT("The video standard of '%s' cannot be split in quad link sub images."), *GetName());
+				return false;
+			}
+
+			// Each link is sent as a single link stream on its own port
+			for (uint32 Link = 0; Link < 4; ++Link)
+			{
+				auto LinkConfig = Deltacast::Device::Config::FSdiPortConfig{};
+
+				LinkConfig.Base           = Base;
+				LinkConfig.Base.PortIndex = Base.PortIndex + Link;
+				LinkConfig.VideoStandard  = SubImageVideoStandard.value();
+				LinkConfig.Interface      = Deltacast::Helpers::GetSingleLinkInterface(SubImageVideoStandard.value(), IsDual);
+
+				if (!LinkConfig.IsValid(*Board))
+				{
+					OutFailureReason = FString::Printf(TEXT("Invalid link configuration: %s"), *LinkConfig.ToString());
+					return false;
+				}
+			}
 
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
+			return true;
+		}
+
+		const auto bIsValid = PortConfig.IsValid(*Board);
 
 		if (!bIsValid)
 		{
@@ -143,16 +286,20 @@ bool UDeltacastMediaOutput::Validate(FString& OutFailureReason) const
 
 		PortConfig.VideoStandard = Deltacast::Helpers::GetDvVideoStandardFromDeviceModeIdentifier(OutputConfiguration.MediaConfiguration.MediaMode.DeviceModeIdentifier);
 
-		const auto BoardHandle = DeltacastSdk.OpenBoard(PortConfig.Base.BoardIndex).value_or(VHD::InvalidHandle);
-		if (!BoardHandle)
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(PortConfig.Base.BoardIndex);
+		if (!Board.IsValid())
 		{
 			OutFailureReason = FString::Printf(TEXT("Failed to validate Deltacast media source because board handle cannot be obtained"));
 			return false;
 		}
 
-		const auto bIsValid = PortConfig.IsValid(BoardHandle);
+		if (!IsPixelFormatSupportedByBoard(PixelFormat, Board->GetInfo()))
+		{
+			OutFailureReason = FString::Printf(TEXT("The board of '%s' does not support its pixel format."), *GetName());
+			return false;
+		}
 
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
+		const auto bIsValid = PortConfig.IsValid(*Board);
 
 		if (!bIsValid)
 		{
@@ -176,6 +323,10 @@ EPixelFormat UDeltacastMediaOutput::GetRequestedPixelFormat() const
 	{
 		case EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422:
 			return OutputConfiguration.OutputType == EMediaIOOutputType::FillAndKey ? EPixelFormat::PF_A16B16G16R16 :EPixelFormat::PF_A2B10G10R10;
+		case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGB:
+			return EPixelFormat::PF_A2B10G10R10;
+		case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGBA:
+			return EPixelFormat::PF_A16B16G16R16;
 		case EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA: [[fallthrough]];
 		case EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422: [[fallthrough]];
 		default:
@@ -185,9 +336,18 @@ EPixelFormat UDeltacastMediaOutput::GetRequestedPixelFormat() const
 
 EMediaCaptureConversionOperation UDeltacastMediaOutput::GetConversionOperation(EMediaCaptureSourceType InSourceType) const
 {
+	// The secondary outputs and the quad link sub images are laid out by the capture along with the configuration,
+	// the engine conversions have neither the HDR transfer functions nor the Rec. 2020 primaries
+	if (!SecondaryConfigurations.IsEmpty() || IsQuadLinkSplitOnGpu() || IsColorConvertedByCapture())
+	{
+		return EMediaCaptureConversionOperation::CUSTOM;
+	}
+
 	switch (PixelFormat)
 	{
-	case EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA:
+	case EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA: [[fallthrough]];
+	case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGB: [[fallthrough]];
+	case EDeltacastMediaOutputPixelFormat::PF_10BIT_RGBA:
 		return EMediaCaptureConversionOperation::NONE;
 	case EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422:
 		return OutputConfiguration.OutputType == EMediaIOOutputType::FillAndKey ? EMediaCaptureConversionOperation::CUSTOM : EMediaCaptureConversionOperation::RGBA8_TO_YUV_8BIT;
@@ -199,6 +359,19 @@ EMediaCaptureConversionOperation UDeltacastMediaOutput::GetConversionOperation(E
 }
 
 
+bool UDeltacastMediaOutput::IsQuadLinkSplitOnGpu() const
+{
+	return bSplitQuadLinkOnGpu &&
+	       OutputConfiguration.MediaConfiguration.MediaConnection.TransportType == EMediaIOTransportType::QuadLink &&
+	       Deltacast::Helpers::IsDeviceModeIdentifierSdi(OutputConfiguration.MediaConfiguration.MediaMode.DeviceModeIdentifier);
+}
+
+bool UDeltacastMediaOutput::IsColorConvertedByCapture() const
+{
+	return TransferFunction != EDeltacastTransferFunction::SDR || Colorimetry == EDeltacastColorimetry::Rec2020;
+}
+
+
 UMediaCapture * UDeltacastMediaOutput::CreateMediaCaptureImpl()
 {
 	UMediaCapture* Result = NewObject<UDeltacastMediaCapture>();
@@ -232,11 +405,11 @@ void UDeltacastMediaOutput::PostEditChangeChainProperty(FPropertyChangedChainEve
 
 		auto &DeltacastSdk = FDeltacast::GetSdk();
 
-		const auto BoardHandle = DeltacastSdk.OpenBoard(DeviceIndex);
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(DeviceIndex);
 
-		if (BoardHandle.has_value())
+		if (Board.IsValid())
 		{
-			const auto ChannelType = DeltacastSdk.GetChannelType(BoardHandle.value(), false, PortIndex);
+			const auto ChannelType = DeltacastSdk.GetChannelType(Board->GetHandle(), false, PortIndex);
 
 			const auto IsSdi = Deltacast::Helpers::IsSdi(ChannelType.value_or(VHD_CHANNELTYPE::NB_VHD_CHANNELTYPE));
 
@@ -246,12 +419,15 @@ void UDeltacastMediaOutput::PostEditChangeChainProperty(FPropertyChangedChainEve
 			}
 
 			if (OutputConfiguration.OutputType == EMediaIOOutputType::FillAndKey &&
-				 PixelFormat == EDeltacastMediaOutputPixelFormat::PF_8BIT_RGBA)
+				 IsPixelFormatRgb(PixelFormat))
 			{
 				PixelFormat = DefaultPixelFormatFillAndKey;
 			}
 
-			DeltacastSdk.CloseBoardHandle(BoardHandle.value());
+			if (!IsPixelFormatSupportedByBoard(PixelFormat, Board->GetInfo()))
+			{
+				PixelFormat = DefaultPixelFormatDv;
+			}
 		}
 	}
 
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastOutputScheduler.h"
+
+#include "Math/UnrealMathUtility.h"
+
+
+
+FDeltacastOutputScheduler::FDeltacastOutputScheduler(const FConfig& InConfig)
+	: Config(InConfig)
+{
+}
+
+
+FDeltacastOutputScheduler::FDecision FDeltacastOutputScheduler::Schedule(const int64 FrameNumber, const uint64 NextPresentationTick, const uint32 FreeSlotCount)
+{
+	const auto Tick = static_cast<int64>(NextPresentationTick);
+
+	FDecision Decision;
+
+	if (!TickOffset.has_value())
+	{
+		TickOffset = Tick - FrameNumber;
+		return Decision;
+	}
+
+	const auto Lead = FrameNumber + TickOffset.value() - Tick;
+	if (FMath::Abs(Lead) > static_cast<int64>(Config.MaximumCorrection))
+	{
+		TickOffset = Tick - FrameNumber;
+		return Decision;
+	}
+
+	if (Lead > 0)
+	{
+		// The frame itself needs a slot after the padding
+		const auto PaddingSlotCount = FMath::Max(static_cast<int64>(FreeSlotCount) - 1, int64{ 0 });
+		Decision.PaddingFrameCount  = static_cast<uint32>(FMath::Min(Lead, PaddingSlotCount));
+	}
+	else if (Lead < 0)
+	{
+		++LateFrameCount;
+
+		if (Config.bDropLateFrames)
+		{
+			Decision.bShouldQueue = false;
+		}
+		else
+		{
+			TickOffset = Tick - FrameNumber;
+		}
+	}
+
+	return Decision;
+}
+
+void FDeltacastOutputScheduler::Reset()
+{
+	TickOffset.reset();
+}
@@ -0,0 +1,73 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreTypes.h"
+
+#include <optional>
+
+
+
+/**
+ * Places each output frame on the output tick matching its timecode frame number.
+ * The first frame fixes the offset between frame numbers and output ticks, each following frame is then expected
+ * on the tick of its frame number. Early frames are preceded by padding frames, late frames are dropped or delay
+ * the schedule. A correction larger than the maximum is treated as a timecode discontinuity and restarts the schedule.
+ * The capture applies the decisions, the scheduler only decides.
+ */
+class FDeltacastOutputScheduler final
+{
+public:
+	struct FConfig
+	{
+		/** Drop the frames behind schedule instead of presenting them and delaying the following ones */
+		bool bDropLateFrames = true;
+
+		/** Largest lead or lag, in frames, corrected before the schedule restarts */
+		uint32 MaximumCorrection = 8;
+	};
+
+	struct FDecision
+	{
+		bool bShouldQueue = true;
+
+		/** Frames to queue before the frame so that it is sent on its tick */
+		uint32 PaddingFrameCount = 0;
+	};
+
+public:
+	explicit FDeltacastOutputScheduler(const FConfig& InConfig);
+
+	/**
+	 * To be called once per engine frame.
+	 * The next presentation tick is the output tick on which a frame queued now is sent, the free slot count bounds the padding.
+	 */
+	[[nodiscard]] FDecision Schedule(int64 FrameNumber, uint64 NextPresentationTick, uint32 FreeSlotCount);
+
+	/** Restarts the schedule on the next frame, to be called when the stream restarts */
+	void Reset();
+
+	/** Number of frames behind schedule since the scheduler was created, dropped or delayed */
+	[[nodiscard]] uint32 GetLateFrameCount() const { return LateFrameCount; }
+
+private:
+	const FConfig Config;
+
+	/** Output tick minus frame number */
+	std::optional<int64> TickOffset;
+
+	uint32 LateFrameCount = 0;
+};
@@ -0,0 +1,176 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastUnderrunFiller.h"
+
+#include "Containers/ArrayView.h"
+#include "DeltacastHelpers.h"
+#include "DeltacastSdk.h"
+#include "HAL/PlatformProcess.h"
+#include "IDeltacastMediaOutputModule.h"
+#include "Misc/ScopeLock.h"
+
+#include <array>
+
+
+
+namespace DeltacastUnderrunFillerUtils
+{
+	/** Black as the little endian words repeated along a line, in the order written by the conversion shaders */
+	TArrayView<const uint32> GetBlackPattern(const VHD_BUFFERPACKING BufferPacking)
+	{
+		static constexpr std::array<uint32, 1> Rgb32     = { 0x00000000 };
+		static constexpr std::array<uint32, 1> Yuv422_8  = { 0x10801080 };
+		static constexpr std::array<uint32, 2> Yuv422_10 = { 0x20010200, 0x04080040 };
+		static constexpr std::array<uint32, 3> Yuvk4224_8  = { 0x10801080, 0x10801010, 0x10101080 };
+		static constexpr std::array<uint32, 2> Yuvk4224_10 = { 0x80040800, 0x10040100 };
+
+		switch (BufferPacking)
+		{
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_32:      [[fallthrough]];
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30:      [[fallthrough]];
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64:     return MakeArrayView(Rgb32.data(), Rgb32.size());
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8:    return MakeArrayView(Yuv422_8.data(), Yuv422_8.size());
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_10:   return MakeArrayView(Yuv422_10.data(), Yuv422_10.size());
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUVK4224_8:  return MakeArrayView(Yuvk4224_8.data(), Yuvk4224_8.size());
+			case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUVK4224_10: return MakeArrayView(Yuvk4224_10.data(), Yuvk4224_10.size());
+			default:
+				return {};
+		}
+	}
+}
+
+
+FDeltacastUnderrunFiller::FDeltacastUnderrunFiller(const FDeltacastUnderrunFillerConfig &InConfig)
+	: Config(InConfig)
+{
+	check(Config.StreamCriticalSection != nullptr);
+	check(Config.StreamHandle != VHD::InvalidHandle);
+	check(Config.LineCount > 0);
+}
+
+
+uint32 FDeltacastUnderrunFiller::Run()
+{
+	const auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	// Polling several times per frame period leaves time to queue the black frame before the next output frame
+	const auto PollInterval = static_cast<float>(Config.FramePeriod / 4.0);
+
+	while (!bStopRequested)
+	{
+		FPlatformProcess::SleepNoStats(PollInterval);
+
+		FScopeLock Lock(Config.StreamCriticalSection);
+
+		const auto RepeatedFrameCount = DeltacastSdk.GetStreamProperty(Config.StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_SLOTS_DROPPED);
+		const auto FilledSlotCount    = DeltacastSdk.GetStreamProperty(Config.StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_FILLING);
+		if (!RepeatedFrameCount.has_value() || !FilledSlotCount.has_value())
+		{
+			continue;
+		}
+
+		const auto bHasRepeated = RepeatedFrameCount.value() > LastRepeatedFrameCount;
+		LastRepeatedFrameCount  = RepeatedFrameCount.value();
+
+		if (bEngineFrameQueued)
+		{
+			bEngineFrameQueued = false;
+			bIsUnderrun        = false;
+		}
+
+		bIsUnderrun = bIsUnderrun || bHasRepeated;
+
+		if (bIsUnderrun && FilledSlotCount.value() == 0 && InsertBlackFrame())
+		{
+			++InsertedFrameCount;
+		}
+	}
+
+	return 0;
+}
+
+void FDeltacastUnderrunFiller::Stop()
+{
+	bStopRequested = true;
+}
+
+
+void FDeltacastUnderrunFiller::OnEngineFrameQueued()
+{
+	bEngineFrameQueued = true;
+}
+
+void FDeltacastUnderrunFiller::OnStreamRestarted()
+{
+	// The repeated frame counter restarts from zero, the repeats counted from the old baseline would be missed
+	LastRepeatedFrameCount = 0;
+	bIsUnderrun            = false;
+}
+
+
+void FDeltacastUnderrunFiller::FillBlack(VHD::BYTE *Buffer, const uint32 BufferSize, const uint32 LineCount, const VHD_BUFFERPACKING BufferPacking)
+{
+	const auto Pattern = DeltacastUnderrunFillerUtils::GetBlackPattern(BufferPacking);
+	if (Pattern.IsEmpty() || LineCount == 0)
+	{
+		std::memset(Buffer, 0, BufferSize);
+		return;
+	}
+
+	// The pattern restarts on each line as the lines may be padded
+	const auto LineWordCount = BufferSize / LineCount / sizeof(uint32);
+	const auto Words         = reinterpret_cast<uint32*>(Buffer);
+
+	for (uint32 Line = 0; Line < LineCount; ++Line)
+	{
+		const auto LineWords = Words + Line * LineWordCount;
+		for (uint32 Word = 0; Word < LineWordCount; ++Word)
+		{
+			LineWords[Word] = Pattern[Word % Pattern.Num()];
+		}
+	}
+}
+
+
+bool FDeltacastUnderrunFiller::InsertBlackFrame() const
+{
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	VHDHandle  SlotHandle     = VHD::InvalidHandle;
+	const auto LockSlotResult = DeltacastSdk.LockSlotHandle(Config.StreamHandle, &SlotHandle);
+	if (!Deltacast::Helpers::IsValid(LockSlotResult))
+	{
+		UE_CLOG(LockSlotResult != VHD_ERRORCODE::VHDERR_TIMEOUT, LogDeltacastMediaOutput, Warning,
+		        TEXT("Failed to lock a slot for a black frame: %s"), *Deltacast::Helpers::GetErrorString(LockSlotResult));
+		return false;
+	}
+
+	VHD::ULONG BufferSize      = 0;
+	VHD::BYTE* Buffer          = nullptr;
+	const auto GetBufferResult = DeltacastSdk.GetSlotBuffer(SlotHandle, static_cast<VHD::ULONG>(VHD_SDI_BUFFERTYPE::VHD_SDI_BT_VIDEO), &Buffer, &BufferSize);
+	if (Deltacast::Helpers::IsValid(GetBufferResult))
+	{
+		FillBlack(Buffer, BufferSize, Config.LineCount, Config.BufferPacking);
+	}
+	else
+	{
+		UE_LOG(LogDeltacastMediaOutput, Warning, TEXT("Failed to get the slot buffer for a black frame: %s"), *Deltacast::Helpers::GetErrorString(GetBufferResult));
+	}
+
+	[[maybe_unused]] const auto UnlockSlotResult = DeltacastSdk.UnlockSlotHandle(SlotHandle);
+
+	return Deltacast::Helpers::IsValid(GetBufferResult);
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "DeltacastDefinition.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+
+#include <atomic>
+
+
+
+struct FDeltacastUnderrunFillerConfig final
+{
+	/** Lock held by the rendering thread while it queues a frame */
+	FCriticalSection *StreamCriticalSection = nullptr;
+
+	VHDHandle StreamHandle = VHD::InvalidHandle;
+
+	VHD_BUFFERPACKING BufferPacking = VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8;
+
+	/** Number of lines in a slot buffer, both fields for interlaced standards */
+	uint32 LineCount = 0;
+
+	double FramePeriod = 1.0 / 60.0;
+};
+
+/**
+ * Queues black frames on an output stream while the engine is late.
+ * The board repeats the last queued frame when its queue runs dry, once such a repeat is detected the filler
+ * queues a black frame each time the queue is empty until the engine queues a frame again.
+ */
+class FDeltacastUnderrunFiller final : public FRunnable
+{
+public:
+	explicit FDeltacastUnderrunFiller(const FDeltacastUnderrunFillerConfig &Config);
+
+public: //~ FRunnable
+	virtual uint32 Run() override;
+
+	virtual void Stop() override;
+
+public:
+	/** Called by the rendering thread, with the stream lock held, after an engine frame was queued */
+	void OnEngineFrameQueued();
+
+	/** Called by the rendering thread, with the stream lock held, after the stream was restarted with its counters */
+	void OnStreamRestarted();
+
+	[[nodiscard]] uint32 GetInsertedFrameCount() const { return InsertedFrameCount.load(); }
+
+public:
+	/** Fills a slot buffer with black, fully transparent for the keyed packings */
+	static void FillBlack(VHD::BYTE *Buffer, uint32 BufferSize, uint32 LineCount, VHD_BUFFERPACKING BufferPacking);
+
+private:
+	[[nodiscard]] bool InsertBlackFrame() const;
+
+private:
+	const FDeltacastUnderrunFillerConfig Config;
+
+	std::atomic<bool> bStopRequested = false;
+
+	bool bIsUnderrun = false;
+	bool bEngineFrameQueued = false;
+
+	uint32 LastRepeatedFrameCount = 0;
+
+	std::atomic<uint32> InsertedFrameCount = 0;
+};
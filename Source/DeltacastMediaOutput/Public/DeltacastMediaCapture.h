@@ -15,12 +15,20 @@
 
 #pragma once
 
+#include "DeltacastBoardRegistry.h"
+#include "DeltacastBufferDepthController.h"
 #include "DeltacastDefinition.h"
+#include "DeltacastHelpers.h"
 #include "MediaCapture.h"
+#include "Misc/FrameRate.h"
 
 #include "DeltacastMediaCapture.generated.h"
 
 
+class FDeltacastOutputScheduler;
+class FDeltacastUnderrunFiller;
+struct FDeltacastColorConversion;
+class FRunnableThread;
 class UDeltacastMediaOutput;
 
 /**
@@ -52,6 +60,8 @@ protected: //~ UMediaCapture interface
 	virtual FIntPoint GetCustomOutputSize(const FIntPoint& InSize) const override;
 	virtual EPixelFormat GetCustomOutputPixelFormat(const EPixelFormat& InPixelFormat) const override;
 
+	virtual const FMatrix& GetRGBToYUVConversionMatrix() const override;
+
 private:
 	bool Initialize(const UDeltacastMediaOutput *InMediaOutput);
 
@@ -60,6 +70,85 @@ private:
 
 	void ResetStatistics() const;
 
+	/** Feeds the statistics of the last frame to the buffer depth controller and restarts the stream when the depth changes, false on failure */
+	[[nodiscard]] bool UpdateBufferDepth();
+
+	/** Starts the thread queuing black frames while the engine is late, false on failure */
+	[[nodiscard]] bool StartUnderrunFiller(double FramePeriod, uint32 LineCount);
+	void StopUnderrunFiller();
+
+	/** Pads the queue up to the tick of the frame timecode, false when the frame must be dropped */
+	[[nodiscard]] bool ScheduleFrame(const FCaptureBaseData &InBaseData);
+
+	/** Queues a copy of the last queued frame on every port, false on failure or when no frame was queued yet */
+	[[nodiscard]] bool QueuePaddingFrame();
+
+private:
+	/** Stream configuration of the port of the configuration, the mirror ports and the secondary outputs */
+	struct FStreamSettings
+	{
+		bool bIsSdiMode       = false;
+		bool bIsDvMode        = false;
+		bool bIsEuropeanClock = true;
+		bool bIsKeyerEnabled  = false;
+		bool bIsGenlocked     = false;
+		bool bIsInterlaced    = false;
+
+		VHD_VIDEOSTANDARD         SdiVideoStandard = VHD_VIDEOSTANDARD::NB_VHD_VIDEOSTANDARDS;
+		VHD_DV_HDMI_VIDEOSTANDARD DvVideoStandard  = VHD_DV_HDMI_VIDEOSTANDARD::NB_VHD_DV_HDMI_VIDEOSTD;
+
+		Deltacast::Helpers::FVideoCharacteristics VideoCharacteristics{};
+
+		VHD::ULONG BufferDepth = 8;
+		VHD::ULONG IOTimeout   = 0;
+	};
+
+	/**
+	 * Port fed from the frame read back for the capture, a mirror port copies the rows of the port of the configuration,
+	 * a quad link split on the GPU or a secondary output its own rows below them
+	 */
+	struct FAdditionalStream
+	{
+		FDeltacastBoardRef Board;
+
+		VHDHandle StreamHandle = VHD::InvalidHandle;
+
+		int32 PortIndex = 0;
+		int32 LinkCount = 1;
+
+		bool bIsInterlaced          = false;
+		bool bFieldMergingSupported = false;
+
+		/** Rows of the read back frame, a count of 0 for the rows of the port of the configuration */
+		int32 RowOffset = 0;
+		int32 RowCount  = 0;
+
+		/** Width of the rows in texels of the read back frame, 0 for the width of the port of the configuration */
+		int32 TexelWidth = 0;
+
+		uint32 DroppedFrameCount = 0;
+	};
+
+	/** Sets the stream properties before the stream starts, false when the connection is not supported */
+	[[nodiscard]] bool ConfigureStream(VHDHandle InStreamHandle, const FDeltacastBoard &InBoard, const FMediaIOConnection &Connection,
+	                                   const FStreamSettings &Settings, bool &bOutFieldMergingSupported) const;
+
+	[[nodiscard]] bool OpenAdditionalStream(const FMediaIOConnection &Connection, const FStreamSettings &Settings, FAdditionalStream &Stream) const;
+	void CloseAdditionalStreams();
+
+	/** Copies the rows of each additional port from the engine buffer to a slot of its stream */
+	void QueueAdditionalFrames(const VHD::BYTE *EngineBuffer, int32 PrimaryHeight, int32 BytesPerRow, uint32 Stride, uint32 TexelSize);
+
+	/** Copies the engine buffer to a slot buffer in the layout of the stream */
+	void CopyToSlot(VHD::BYTE *Buffer, VHD::ULONG BufferSize, bool bIsInterlacedStream, bool bIsFieldMerged, const VHD::BYTE *EngineBuffer, int32 Height, int32 BytesPerRow, uint32 Stride) const;
+
+	/** Converts the input rectangle to the pixel format of the output into the output rectangle, loading the output when other passes wrote to it */
+	void AddPackingPass(FRDGBuilder &GraphBuilder, FRDGTextureRef InputTexture, const FIntRect &InputRect, FRDGTextureRef OutputTexture, const FIntRect &OutputRect,
+	                    ERenderTargetLoadAction LoadAction) const;
+
+	/** Transfer function and primaries of the output evaluated by the packing pass */
+	[[nodiscard]] FDeltacastColorConversion GetColorConversion() const;
+
 private:
 	void ApplyViewportTextureAlpha(const TSharedPtr<FSceneViewport> &InSceneViewport);
 	void RestoreViewportTextureAlpha(const TSharedPtr<FSceneViewport> &InSceneViewport);
@@ -80,10 +169,59 @@ private:
 
 	bool bFieldMergingSupported = false;
 
+	uint32 BufferDepth = 8;
+
+	/** Number of frames queued before the stream starts sending, bounded by the depth when the stream starts */
+	uint32 BufferPreLoad = 4;
+
+	std::optional<FDeltacastBufferDepthController> BufferDepthController;
+	Deltacast::Helpers::FStreamStatistics          BufferDepthStatistics{};
+
 private:
+	FDeltacastBoardRef Board;
+
 	VHDHandle BoardHandle = VHD::InvalidHandle;
 	VHDHandle StreamHandle = VHD::InvalidHandle;
 
 	uint32 AdjacentFrameDropped = 0;
 	uint32 LastFrameDroppedWarnedCount = 0;
+
+	/** Engine frames dropped because no slot could be locked within the slot lock timeout */
+	uint32 DroppedFrameCount = 0;
+
+private:
+	TSharedPtr<FDeltacastOutputScheduler> OutputScheduler;
+
+	FFrameRate OutputFrameRate;
+
+	uint32 FrameLineCount = 0;
+
+	/** Rows of the last engine frame queued, kept for the padding frames as the queued slot buffers belong to the SDK */
+	struct FQueuedFrame
+	{
+		TArray<VHD::BYTE> Rows;
+
+		int32  Height      = 0;
+		int32  BytesPerRow = 0;
+		uint32 Stride      = 0;
+		uint32 TexelSize   = 0;
+	};
+
+	FQueuedFrame LastQueuedFrame;
+
+	uint32 PaddedFrameCount = 0;
+
+private:
+	TArray<FAdditionalStream> AdditionalStreams;
+
+	/** Rows of the port of the configuration in the read back frame, the secondary outputs follow */
+	int32 PrimaryRowCount = 0;
+
+	/** Texels of a row of the port of the configuration, or of one link of a quad link frame split on the GPU */
+	int32 PrimaryTexelWidth = 0;
+
+private:
+	TSharedPtr<FDeltacastUnderrunFiller, ESPMode::ThreadSafe> UnderrunFiller;
+
+	FRunnableThread *UnderrunFillerThread = nullptr;
 };
\ No newline at end of file
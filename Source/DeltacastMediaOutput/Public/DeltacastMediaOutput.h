@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "DeltacastMediaColor.h"
 #include "MediaOutput.h"
 #include "MediaIOCoreDefinitions.h"
 
@@ -30,6 +31,47 @@ enum class EDeltacastMediaOutputPixelFormat : uint8
 	PF_8BIT_RGBA UMETA(DisplayName = "8bit RGBA"),
 	PF_8BIT_YUV422 UMETA(DisplayName = "8bit YUV"),
 	PF_10BIT_YUV422 UMETA(DisplayName = "10bit YUV"),
+	PF_10BIT_RGB UMETA(DisplayName = "10bit RGB"),
+	PF_10BIT_RGBA UMETA(DisplayName = "10bit RGBA"),
+};
+
+/**
+ * Frame sent by the device when no new frame was queued in time.
+ */
+UENUM()
+enum class EDeltacastOutputUnderrunPolicy : uint8
+{
+	/** The device sends the last frame again */
+	RepeatLastFrame UMETA(DisplayName = "Repeat Last Frame"),
+	/** The device sends the last frame again once, then black frames until the engine catches up */
+	InsertBlack UMETA(DisplayName = "Insert Black"),
+};
+
+/**
+ * When the frames are sent by the device.
+ */
+UENUM()
+enum class EDeltacastOutputScheduling : uint8
+{
+	/** Each frame is queued as soon as it is captured */
+	Immediate UMETA(DisplayName = "Immediate"),
+	/** Each frame is sent on the output frame matching its timecode */
+	Timecode UMETA(DisplayName = "Timecode"),
+};
+
+/**
+ * What happens to a frame captured after the output frame matching its timecode.
+ */
+UENUM()
+enum class EDeltacastLateFramePolicy : uint8
+{
+	/** The frame is dropped, the following frames keep their schedule */
+	Drop UMETA(DisplayName = "Drop"),
+	/**
+	 * The frame is sent late, the following frames are delayed by the same amount.
+	 * Rejected by the validation while the schedule of each output is anchored on its own stream.
+	 */
+	Delay UMETA(DisplayName = "Delay"),
 };
 
 
@@ -50,14 +92,108 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Output")
 	EDeltacastMediaOutputPixelFormat PixelFormat = DefaultPixelFormatDv;
 
+	/**
+	 * Primaries and YUV matrix of the signal.
+	 * With Rec. 2020, linear frames are converted from the Rec. 709 primaries of the engine before being encoded.
+	 * Rec. 2020 SDR frames must be linear, with the linear to sRGB conversion of the capture options.
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Output", meta = (EditCondition = "PixelFormat == EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422 || PixelFormat == EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422"))
+	EDeltacastColorimetry Colorimetry = EDeltacastColorimetry::Auto;
+
+	/**
+	 * Transfer function of the signal, evaluated in the YUV conversion pass of the capture.
+	 * PQ and HLG expect linear frames, the linear to sRGB conversion of the capture options is then ignored.
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Output", meta = (EditCondition = "PixelFormat == EDeltacastMediaOutputPixelFormat::PF_8BIT_YUV422 || PixelFormat == EDeltacastMediaOutputPixelFormat::PF_10BIT_YUV422"))
+	EDeltacastTransferFunction TransferFunction = EDeltacastTransferFunction::SDR;
+
+	/** Luminance of the linear value 1.0, in nits, HLG is referred to a 1000 nits peak. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Output", meta = (ClampMin = 1, ClampMax = 10000, EditCondition = "TransferFunction != EDeltacastTransferFunction::SDR"))
+	int32 HdrReferenceWhiteNits = 100;
+
 	/**
 	 * Number of frame used by the Deltacast SDK.
 	 * A smaller number is most likely to cause missed frame.
 	 * A bigger number is most likely to increase latency.
+	 * Upper bound of the depth when the buffer depth is adaptive.
 	 */
 	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output", meta = (ClampMin = 2, ClampMax = 32))
 	int32 NumberOfDeltacastBuffers = 8;
 
+	/**
+	 * Start with the minimum number of Deltacast buffers and adjust it from the repeated frames and the buffer fill.
+	 * Each adjustment restarts the stream and is logged.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output")
+	bool bAdaptiveBufferDepth = false;
+
+	/** Lower bound of the depth when the buffer depth is adaptive. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output", meta = (ClampMin = 2, ClampMax = 32, EditCondition = "bAdaptiveBufferDepth"))
+	int32 MinimumNumberOfDeltacastBuffers = 2;
+
+	/**
+	 * Number of frames queued before the device starts sending them, clamped to the number of Deltacast buffers.
+	 * A bigger number absorbs more late frames at the start and increases latency.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output", meta = (ClampMin = 1, ClampMax = 32))
+	int32 NumberOfPreloadedBuffers = 4;
+
+	/**
+	 * Time the rendering thread waits for a free Deltacast buffer before dropping the frame.
+	 * 0 drops the frame immediately, waiting stalls the rendering thread.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output", meta = (ClampMin = 0, ClampMax = 100, Units = "ms"))
+	int32 SlotLockTimeoutMs = 0;
+
+	/** Frame sent when the engine is late, each frame not coming from the engine is counted in the repeated frames. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output")
+	EDeltacastOutputUnderrunPolicy UnderrunPolicy = EDeltacastOutputUnderrunPolicy::RepeatLastFrame;
+
+	/**
+	 * Send each frame on the output frame matching its timecode, the first frame sets the schedule.
+	 * A skipped timecode repeats the previous frame, so that outputs sharing a genlock stay aligned.
+	 * Each output anchors the schedule on its own first frame, the outputs must start on the same engine frame.
+	 * Not available with an adaptive buffer depth or delayed late frames, a stream restart or a delay would move one output out of phase.
+	 * The timecode rate is expected to match the output frame rate.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output")
+	EDeltacastOutputScheduling Scheduling = EDeltacastOutputScheduling::Immediate;
+
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output", meta = (EditCondition = "Scheduling == EDeltacastOutputScheduling::Timecode"))
+	EDeltacastLateFramePolicy LateFramePolicy = EDeltacastLateFramePolicy::Drop;
+
+	/** Largest lead or lag, in frames, corrected before the schedule restarts on a timecode discontinuity, the restart anchors it on the output again. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output", meta = (ClampMin = 1, ClampMax = 32, EditCondition = "Scheduling == EDeltacastOutputScheduling::Timecode"))
+	int32 MaximumScheduleCorrection = 8;
+
+	/**
+	 * Additional ports sent the same frames, with the video mode, pixel format, output type and reference of the configuration.
+	 * The frame is converted and read back once, then copied to each port.
+	 * The timecode scheduling pads every port and a frame dropped by the port of the configuration is dropped by all of them.
+	 * Not available with an adaptive buffer depth or the black underrun policy, which would only drive the port of the configuration.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output")
+	TArray<FMediaIOConnection> MirrorConnections;
+
+	/**
+	 * Additional outputs with their own port and video mode, scaled from the same frame.
+	 * They share the pixel format, output type and reference of the configuration, their frame rate must match and their width cannot exceed it.
+	 * The pixel format is shared as the frame read back for all the outputs has the single texture format of that pixel format.
+	 * Each one is scaled and converted in the render graph of the capture then read back with the port of the configuration in a single frame.
+	 * Not available with an adaptive buffer depth or the black underrun policy, which would only drive the port of the configuration.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output")
+	TArray<FMediaIOConfiguration> SecondaryConfigurations;
+
+	/**
+	 * Split quad link frames in the render graph of the capture into the four link ordered sub images of the quad transport type,
+	 * and send each one as a single link stream on the port of the configuration and the three following ones.
+	 * Opens quad link on boards without quad link interfaces. Not available with mirror ports, an adaptive buffer depth,
+	 * the black underrun policy or the timecode scheduling, which would only drive the first link.
+	 */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Output")
+	bool bSplitQuadLinkOnGpu = false;
+
 public:
 	/** Burn Frame Timecode on the output without any frame number clipping. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Debug", meta = (DisplayName = "Burn Frame Timecode"))
@@ -75,10 +211,22 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, AdvancedDisplay, Category = "Debug")
 	bool bUpdateRepeatedFrameCount = DefaultDebugOption;
 
-	/** Number of dropped frames since capture was started. */
+	/** Number of frames sent by the device that did not come from the engine since capture was started, repeated or black. */
 	UPROPERTY(BlueprintReadOnly, VisibleDefaultsOnly, AdvancedDisplay, Category = "Debug", meta = (EditCondition = "bUpdateRepeatedFrameCount", EditConditionHides))
 	int32 RepeatedFrameCount = 0;
 
+	/** Number of black frames inserted since capture was started, included in the repeated frames. */
+	UPROPERTY(BlueprintReadOnly, VisibleDefaultsOnly, AdvancedDisplay, Category = "Debug", meta = (EditCondition = "bUpdateRepeatedFrameCount", EditConditionHides))
+	int32 InsertedBlackFrameCount = 0;
+
+	/** Number of engine frames dropped because no Deltacast buffer was free in time since capture was started, on all the ports. */
+	UPROPERTY(BlueprintReadOnly, VisibleDefaultsOnly, AdvancedDisplay, Category = "Debug", meta = (EditCondition = "bUpdateRepeatedFrameCount", EditConditionHides))
+	int32 DroppedFrameCount = 0;
+
+	/** Number of frames captured after the output frame matching their timecode since capture was started, dropped or delayed. */
+	UPROPERTY(BlueprintReadOnly, VisibleDefaultsOnly, AdvancedDisplay, Category = "Debug", meta = (EditCondition = "bUpdateRepeatedFrameCount", EditConditionHides))
+	int32 LateFrameCount = 0;
+
 	/** Enable the update of the number of processed frames. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, AdvancedDisplay, Category = "Debug")
 	bool bUpdateBufferFill = DefaultDebugOption;
@@ -93,6 +241,13 @@ public: //~ UMediaOutput
 	virtual EPixelFormat                     GetRequestedPixelFormat() const override;
 	virtual EMediaCaptureConversionOperation GetConversionOperation(EMediaCaptureSourceType InSourceType) const override;
 
+public:
+	/** Whether the capture splits the quad link frames itself, see bSplitQuadLinkOnGpu */
+	[[nodiscard]] bool IsQuadLinkSplitOnGpu() const;
+
+	/** Whether the transfer function or the primaries need the conversion shaders of the capture */
+	[[nodiscard]] bool IsColorConvertedByCapture() const;
+
 protected: //~ UMediaOutput
 	virtual UMediaCapture *CreateMediaCaptureImpl() override;
 
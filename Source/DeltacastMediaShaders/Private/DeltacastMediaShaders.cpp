@@ -0,0 +1,257 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastMediaShaders.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+#include "DataDrivenShaderPlatformInfo.h"
+#include "RenderGraphBuilder.h"
+#include "RHIStaticStates.h"
+
+namespace DeltacastMediaShaders
+{
+	const FMatrix RgbToYuvRec601Scaled = FMatrix(
+		FPlane(0.256788, 0.504129, 0.097906, 0.000000),
+		FPlane(-0.148223, -0.290993, 0.439216, 0.000000),
+		FPlane(0.439216, -0.367788, -0.071427, 0.000000),
+		FPlane(0.000000, 0.000000, 0.000000, 0.000000)
+	);
+
+	const FMatrix RgbToYuvRec2020Scaled = FMatrix(
+		FPlane(0.225613, 0.582282, 0.050928, 0.000000),
+		FPlane(-0.122655, -0.316560, 0.439216, 0.000000),
+		FPlane(0.439216, -0.403889, -0.035325, 0.000000),
+		FPlane(0.000000, 0.000000, 0.000000, 0.000000)
+	);
+
+	const FMatrix YuvToRgbRec2020Scaled = FMatrix(
+		FPlane(1.164384, 0.000000, 1.678674, 0.000000),
+		FPlane(1.164384, -0.187326, -0.650424, 0.000000),
+		FPlane(1.164384, 2.141772, 0.000000, 0.000000),
+		FPlane(0.000000, 0.000000, 0.000000, 0.000000)
+	);
+
+	// ITU-R BT.2087 and its inverse
+	const FMatrix Rec709ToRec2020 = FMatrix(
+		FPlane(0.627404, 0.329283, 0.043313, 0.000000),
+		FPlane(0.069097, 0.919540, 0.011362, 0.000000),
+		FPlane(0.016391, 0.088013, 0.895595, 0.000000),
+		FPlane(0.000000, 0.000000, 0.000000, 1.000000)
+	);
+
+	const FMatrix Rec2020ToRec709 = FMatrix(
+		FPlane(1.660491, -0.587641, -0.072850, 0.000000),
+		FPlane(-0.124550, 1.132900, -0.008349, 0.000000),
+		FPlane(-0.018151, -0.100579, 1.118730, 0.000000),
+		FPlane(0.000000, 0.000000, 0.000000, 1.000000)
+	);
+}
+
+FDeltacastColorConversion FDeltacastColorConversion::Make(const EDeltacastTransferFunction TransferFunction, const float ReferenceWhiteNits, const bool bIsSrgb)
+{
+	FDeltacastColorConversion Conversion;
+
+	switch (TransferFunction)
+	{
+	case EDeltacastTransferFunction::PQ:
+		Conversion.Transfer       = ETransfer::PQ;
+		Conversion.ReferenceWhite = ReferenceWhiteNits / 10000.0f;
+		break;
+	case EDeltacastTransferFunction::HLG:
+		Conversion.Transfer       = ETransfer::HLG;
+		Conversion.ReferenceWhite = ReferenceWhiteNits / 1000.0f;
+		break;
+	case EDeltacastTransferFunction::SDR: [[fallthrough]];
+	default:
+		Conversion.Transfer = bIsSrgb ? ETransfer::Srgb : ETransfer::None;
+		break;
+	}
+
+	return Conversion;
+}
+
+/** Setup YUV Offset in matrix */
+FMatrix CombineColorTransformAndOffset(const FMatrix& InMatrix, const FVector& InYUVOffset)
+{
+	FMatrix Result = InMatrix;
+	// Offset in last column:
+	// 1) to allow for 4x4 matrix multiplication optimization when going from RGB to YUV (hence the 1.0 in the [3][3] matrix location)
+	// 2) stored in empty space when going from YUV to RGB
+	Result.M[0][3] = InYUVOffset.X;
+	Result.M[1][3] = InYUVOffset.Y;
+	Result.M[2][3] = InYUVOffset.Z;
+	Result.M[3][3] = 1.0f;
+	return Result;
+}
+
+/** Setup the transfer function and the primaries conversion */
+void SetColorConversionParameters(FDeltacastColorConversionParameters& Parameters, const FDeltacastColorConversion& ColorConversion)
+{
+	Parameters.ColorGamut          = (FMatrix44f)ColorConversion.Gamut;
+	Parameters.ColorTransfer       = static_cast<uint32>(ColorConversion.Transfer);
+	Parameters.ColorReferenceWhite = ColorConversion.ReferenceWhite;
+}
+ 
+/* FRGBA8toYUVK4224ConvertPS shader
+ *****************************************************************************/
+
+IMPLEMENT_GLOBAL_SHADER(FRGBA8toYUVK4224ConvertPS, "/Plugin/DeltacastMedia/Private/DeltacastMediaShaders.usf", "RGBA8toYUVK8ConvertPS", SF_Pixel);
+
+FRGBA8toYUVK4224ConvertPS::FParameters* FRGBA8toYUVK4224ConvertPS::AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBATexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction)
+{
+	FRGBA8toYUVK4224ConvertPS::FParameters* Parameters = GraphBuilder.AllocParameters<FRGBA8toYUVK4224ConvertPS::FParameters>();
+
+	Parameters->RGBAToYUVKConversion.InputTexture = RGBATexture;
+	Parameters->RGBAToYUVKConversion.InputSampler = TStaticSamplerState<SF_Point>::GetRHI();
+	Parameters->RGBAToYUVKConversion.ColorTransform = (FMatrix44f)CombineColorTransformAndOffset(ColorTransform, YUVOffset);
+	SetColorConversionParameters(Parameters->RGBAToYUVKConversion.ColorConversion, ColorConversion);
+	Parameters->RGBAToYUVKConversion.OnePixelDeltaX = 1.0f / (float)RGBATexture->Desc.Extent.X;
+
+	//Output texture will be based on a size dividable by 48 (i.e 1280 -> 1296) and divided by 6 (i.e 1296 / 6 = 216)
+	//To map output texture UVs, we get a scale from the source texture original size to the mapped output size
+	//And use the source texture size to get the pixel delta
+	const float PaddedResolution = float(uint32((RGBATexture->Desc.Extent.X + 47) / 48) * 48);
+	Parameters->PaddingScale = PaddedResolution / (float)RGBATexture->Desc.Extent.X;
+
+	Parameters->RenderTargets[0] = FRenderTargetBinding{ OutputTexture, LoadAction };
+
+	return Parameters;
+}
+ 
+/* FRGBA10toYUVK4224ConvertPS shader
+ *****************************************************************************/
+
+IMPLEMENT_GLOBAL_SHADER(FRGBA16toYUVK4224ConvertPS, "/Plugin/DeltacastMedia/Private/DeltacastMediaShaders.usf", "RGBA16toYUVK10ConvertPS", SF_Pixel);
+
+FRGBA16toYUVK4224ConvertPS::FParameters* FRGBA16toYUVK4224ConvertPS::AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBATexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction)
+{
+	FRGBA16toYUVK4224ConvertPS::FParameters* Parameters = GraphBuilder.AllocParameters<FRGBA16toYUVK4224ConvertPS::FParameters>();
+
+	Parameters->RGBAToYUVKConversion.InputTexture = RGBATexture;
+	Parameters->RGBAToYUVKConversion.InputSampler = TStaticSamplerState<SF_Point>::GetRHI();
+	Parameters->RGBAToYUVKConversion.ColorTransform = (FMatrix44f)CombineColorTransformAndOffset(ColorTransform, YUVOffset);
+	SetColorConversionParameters(Parameters->RGBAToYUVKConversion.ColorConversion, ColorConversion);
+	Parameters->RGBAToYUVKConversion.OnePixelDeltaX = 1.0f / (float)RGBATexture->Desc.Extent.X;
+
+	//Output texture will be based on a size dividable by 48 (i.e 1280 -> 1296) and divided by 6 (i.e 1296 / 6 = 216)
+	//To map output texture UVs, we get a scale from the source texture original size to the mapped output size
+	//And use the source texture size to get the pixel delta
+	const float PaddedResolution = float(uint32((RGBATexture->Desc.Extent.X + 47) / 48) * 48);
+	Parameters->PaddingScale = PaddedResolution / (float)RGBATexture->Desc.Extent.X;
+
+	Parameters->RenderTargets[0] = FRenderTargetBinding{ OutputTexture, LoadAction };
+
+	return Parameters;
+}
+
+/* FDeltacastRGBtoUYVYConvertPS shader
+ *****************************************************************************/
+
+IMPLEMENT_GLOBAL_SHADER(FDeltacastRGBtoUYVYConvertPS, "/Plugin/DeltacastMedia/Private/DeltacastMediaShaders.usf", "RGBtoUYVY8ConvertPS", SF_Pixel);
+
+FDeltacastRGBtoUYVYConvertPS::FParameters* FDeltacastRGBtoUYVYConvertPS::AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBTexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction)
+{
+	FDeltacastRGBtoUYVYConvertPS::FParameters* Parameters = GraphBuilder.AllocParameters<FDeltacastRGBtoUYVYConvertPS::FParameters>();
+
+	Parameters->RGBAToYUVKConversion.InputTexture = RGBTexture;
+	Parameters->RGBAToYUVKConversion.InputSampler = TStaticSamplerState<SF_Point>::GetRHI();
+	Parameters->RGBAToYUVKConversion.ColorTransform = (FMatrix44f)CombineColorTransformAndOffset(ColorTransform, YUVOffset);
+	SetColorConversionParameters(Parameters->RGBAToYUVKConversion.ColorConversion, ColorConversion);
+	Parameters->RGBAToYUVKConversion.OnePixelDeltaX = 1.0f / (float)RGBTexture->Desc.Extent.X;
+
+	Parameters->RenderTargets[0] = FRenderTargetBinding{ OutputTexture, LoadAction };
+
+	return Parameters;
+}
+
+/* FDeltacastRGBtoV210ConvertPS shader
+ *****************************************************************************/
+
+IMPLEMENT_GLOBAL_SHADER(FDeltacastRGBtoV210ConvertPS, "/Plugin/DeltacastMedia/Private/DeltacastMediaShaders.usf", "RGBtoYUVv210ConvertPS", SF_Pixel);
+
+FDeltacastRGBtoV210ConvertPS::FParameters* FDeltacastRGBtoV210ConvertPS::AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBTexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction)
+{
+	FDeltacastRGBtoV210ConvertPS::FParameters* Parameters = GraphBuilder.AllocParameters<FDeltacastRGBtoV210ConvertPS::FParameters>();
+
+	Parameters->RGBAToYUVKConversion.InputTexture = RGBTexture;
+	Parameters->RGBAToYUVKConversion.InputSampler = TStaticSamplerState<SF_Point>::GetRHI();
+	Parameters->RGBAToYUVKConversion.ColorTransform = (FMatrix44f)CombineColorTransformAndOffset(ColorTransform, YUVOffset);
+	SetColorConversionParameters(Parameters->RGBAToYUVKConversion.ColorConversion, ColorConversion);
+	Parameters->RGBAToYUVKConversion.OnePixelDeltaX = 1.0f / (float)RGBTexture->Desc.Extent.X;
+
+	// Each output texel packs 6 pixels of a line padded to 48 pixels
+	const float PaddedResolution = float(uint32((RGBTexture->Desc.Extent.X + 47) / 48) * 48);
+	Parameters->PaddingScale = PaddedResolution / (float)RGBTexture->Desc.Extent.X;
+
+	Parameters->RenderTargets[0] = FRenderTargetBinding{ OutputTexture, LoadAction };
+
+	return Parameters;
+}
+
+/* FDeltacastDeinterlaceCS shader
+ *****************************************************************************/
+
+IMPLEMENT_GLOBAL_SHADER(FDeltacastDeinterlaceCS, "/Plugin/DeltacastMedia/Private/DeltacastMediaShaders.usf", "DeinterlaceCS", SF_Compute);
+
+bool FDeltacastDeinterlaceCS::ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+{
+	return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+}
+
+void FDeltacastDeinterlaceCS::ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+{
+	FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+	OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZE"), ThreadGroupSize);
+}
+
+FDeltacastDeinterlaceCS::FParameters* FDeltacastDeinterlaceCS::AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGBufferRef FrameBuffer, const FDesc& Desc, FRDGTextureRef OutputTexture)
+{
+	FDeltacastDeinterlaceCS::FParameters* Parameters = GraphBuilder.AllocParameters<FDeltacastDeinterlaceCS::FParameters>();
+
+	Parameters->DeinterlaceFrame  = GraphBuilder.CreateSRV(FrameBuffer);
+	Parameters->DeinterlaceOutput = GraphBuilder.CreateUAV(OutputTexture);
+
+	Parameters->DeinterlaceYuvToRgb        = (FMatrix44f)CombineColorTransformAndOffset(Desc.YuvToRgb, Desc.YuvOffset);
+	Parameters->DeinterlaceFrameSize       = Desc.FrameSize;
+	Parameters->DeinterlaceFieldFirstRow   = FUintVector2(Desc.TopFieldFirstRow, Desc.BottomFieldFirstRow);
+	Parameters->DeinterlaceStrideInWords   = Desc.Stride / sizeof(uint32);
+	Parameters->DeinterlaceFieldRowStep    = Desc.FieldRowStep;
+	Parameters->DeinterlaceField           = Desc.bIsTopField ? 0 : 1;
+	Parameters->DeinterlaceMode            = static_cast<uint32>(Desc.Mode);
+	Parameters->DeinterlaceFormat          = static_cast<uint32>(Desc.Format);
+	SetColorConversionParameters(Parameters->ColorConversion, Desc.ColorConversion);
+	Parameters->DeinterlaceCombThreshold = Desc.CombThreshold;
+
+	return Parameters;
+}
+
+/* FDeltacastQuadLinkSplitPS shader
+ *****************************************************************************/
+
+IMPLEMENT_GLOBAL_SHADER(FDeltacastQuadLinkSplitPS, "/Plugin/DeltacastMedia/Private/DeltacastMediaShaders.usf", "QuadLinkSplitPS", SF_Pixel);
+
+FDeltacastQuadLinkSplitPS::FParameters* FDeltacastQuadLinkSplitPS::AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef InputTexture, const FIntRect& InputRect, EMode Mode, FRDGTextureRef OutputTexture)
+{
+	FDeltacastQuadLinkSplitPS::FParameters* Parameters = GraphBuilder.AllocParameters<FDeltacastQuadLinkSplitPS::FParameters>();
+
+	Parameters->QuadLinkInput        = InputTexture;
+	Parameters->QuadLinkInputMin     = InputRect.Min;
+	Parameters->QuadLinkSubImageSize = FUintVector2(InputRect.Width() / 2, InputRect.Height() / 2);
+	Parameters->QuadLinkMode         = static_cast<uint32>(Mode);
+
+	Parameters->RenderTargets[0] = FRenderTargetBinding{ OutputTexture, ERenderTargetLoadAction::ENoAction };
+
+	return Parameters;
+}
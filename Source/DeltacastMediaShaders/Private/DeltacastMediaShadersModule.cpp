@@ -0,0 +1,31 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Interfaces/IPluginManager.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "ShaderCore.h"
+
+class FDeltacastMediaShadersModule : public IModuleInterface
+{
+public: //~IModuleInterface interface
+   virtual void StartupModule() override
+   {
+      FString PluginShaderDir = FPaths::Combine(IPluginManager::Get().FindPlugin(TEXT("DeltacastMedia"))->GetBaseDir(), TEXT("Shaders"));
+      AddShaderSourceDirectoryMapping(TEXT("/Plugin/DeltacastMedia"), PluginShaderDir);
+   }
+};
+
+IMPLEMENT_MODULE(FDeltacastMediaShadersModule, DeltacastMediaShaders)
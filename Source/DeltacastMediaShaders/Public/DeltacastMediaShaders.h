@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DeltacastMediaColor.h"
+#include "GlobalShader.h"
+#include "ShaderParameterStruct.h"
+
+namespace DeltacastMediaShaders
+{
+	/** YUV matrices missing from MediaShaders, scaled to the video range, with the same layout */
+	DELTACASTMEDIASHADERS_API extern const FMatrix RgbToYuvRec601Scaled;
+	DELTACASTMEDIASHADERS_API extern const FMatrix RgbToYuvRec2020Scaled;
+	DELTACASTMEDIASHADERS_API extern const FMatrix YuvToRgbRec2020Scaled;
+
+	/** Linear RGB primaries conversions */
+	DELTACASTMEDIASHADERS_API extern const FMatrix Rec709ToRec2020;
+	DELTACASTMEDIASHADERS_API extern const FMatrix Rec2020ToRec709;
+}
+
+/**
+ * Transfer function and primaries conversion evaluated by the conversion shaders next to the YUV matrix.
+ * RGB to YUV encodes linear values, YUV to RGB decodes them, the primaries are converted on the linear values.
+ */
+struct FDeltacastColorConversion
+{
+	/** Values match the TRANSFER_* defines of the shader */
+	enum class ETransfer : uint32
+	{
+		None,
+		Srgb,
+		PQ,
+		HLG,
+	};
+
+	ETransfer Transfer = ETransfer::None;
+
+	/** Reference white relative to the signal peak, 10000 nits for PQ and the 1000 nits nominal peak for HLG. The linear value 1.0 is the reference white. */
+	float ReferenceWhite = 1.0f;
+
+	/** Identity when the primaries are kept, unused without transfer function */
+	FMatrix Gamut = FMatrix::Identity;
+
+	/** Conversion for the transfer function of an asset, SDR uses the sRGB curve when bIsSrgb */
+	DELTACASTMEDIASHADERS_API static FDeltacastColorConversion Make(EDeltacastTransferFunction TransferFunction, float ReferenceWhiteNits, bool bIsSrgb);
+};
+
+BEGIN_SHADER_PARAMETER_STRUCT(FDeltacastColorConversionParameters, DELTACASTMEDIASHADERS_API)
+	SHADER_PARAMETER(FMatrix44f, ColorGamut)
+	SHADER_PARAMETER(uint32, ColorTransfer)
+	SHADER_PARAMETER(float, ColorReferenceWhite)
+END_SHADER_PARAMETER_STRUCT()
+
+ /** Struct of common parameters used in media capture shaders to do RGB to YUV conversions */
+BEGIN_SHADER_PARAMETER_STRUCT(FRGBAToYUVKConversion, DELTACASTMEDIASHADERS_API)
+	SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputTexture)
+	SHADER_PARAMETER_SAMPLER(SamplerState, InputSampler)
+	SHADER_PARAMETER(FMatrix44f, ColorTransform)
+	SHADER_PARAMETER_STRUCT_INCLUDE(FDeltacastColorConversionParameters, ColorConversion)
+	SHADER_PARAMETER(float, OnePixelDeltaX)
+END_SHADER_PARAMETER_STRUCT()
+
+/**
+ * Pixel shader to convert RGBA 8 bits to YUVK 4224 8 bits
+ */
+class FRGBA8toYUVK4224ConvertPS : public FGlobalShader
+{
+public:
+	DECLARE_EXPORTED_GLOBAL_SHADER(FRGBA8toYUVK4224ConvertPS, DELTACASTMEDIASHADERS_API);
+
+	SHADER_USE_PARAMETER_STRUCT(FRGBA8toYUVK4224ConvertPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FRGBAToYUVKConversion, RGBAToYUVKConversion)
+		SHADER_PARAMETER(float, PaddingScale)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+public:
+	/** Allocates and setup shader parameter in the incoming graph builder */
+	DELTACASTMEDIASHADERS_API FRGBA8toYUVK4224ConvertPS::FParameters* AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBATexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction);
+};
+
+/**
+ * Pixel shader to convert RGBA 16 bits to YUVK 4224 10bits
+ */
+class FRGBA16toYUVK4224ConvertPS : public FGlobalShader
+{
+public:
+	DECLARE_EXPORTED_GLOBAL_SHADER(FRGBA16toYUVK4224ConvertPS, DELTACASTMEDIASHADERS_API);
+
+	SHADER_USE_PARAMETER_STRUCT(FRGBA16toYUVK4224ConvertPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FRGBAToYUVKConversion, RGBAToYUVKConversion)
+		SHADER_PARAMETER(float, PaddingScale)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+public:
+	/** Allocates and setup shader parameter in the incoming graph builder */
+	DELTACASTMEDIASHADERS_API FRGBA16toYUVK4224ConvertPS::FParameters* AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBATexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction);
+};
+
+/**
+ * Pixel shader to convert RGB to UYVY 8 bits, one 32 bits word per two pixels
+ */
+class FDeltacastRGBtoUYVYConvertPS : public FGlobalShader
+{
+public:
+	DECLARE_EXPORTED_GLOBAL_SHADER(FDeltacastRGBtoUYVYConvertPS, DELTACASTMEDIASHADERS_API);
+
+	SHADER_USE_PARAMETER_STRUCT(FDeltacastRGBtoUYVYConvertPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FRGBAToYUVKConversion, RGBAToYUVKConversion)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+public:
+	/** Allocates and setup shader parameter in the incoming graph builder */
+	DELTACASTMEDIASHADERS_API FDeltacastRGBtoUYVYConvertPS::FParameters* AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBTexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction);
+};
+
+/**
+ * Pixel shader to convert RGB to YUV v210 10 bits, four 32 bits words per six pixels
+ */
+class FDeltacastRGBtoV210ConvertPS : public FGlobalShader
+{
+public:
+	DECLARE_EXPORTED_GLOBAL_SHADER(FDeltacastRGBtoV210ConvertPS, DELTACASTMEDIASHADERS_API);
+
+	SHADER_USE_PARAMETER_STRUCT(FDeltacastRGBtoV210ConvertPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FRGBAToYUVKConversion, RGBAToYUVKConversion)
+		SHADER_PARAMETER(float, PaddingScale)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+public:
+	/** Allocates and setup shader parameter in the incoming graph builder */
+	DELTACASTMEDIASHADERS_API FDeltacastRGBtoV210ConvertPS::FParameters* AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef RGBTexture, const FMatrix& ColorTransform, const FVector& YUVOffset, const FDeltacastColorConversion& ColorConversion, FRDGTextureRef OutputTexture, ERenderTargetLoadAction LoadAction);
+};
+
+/**
+ * Compute shader to deinterlace one field of an interlaced capture buffer into a full height RGBA texture.
+ * Progressive frames needing a color conversion the engine does not have are read as two woven fields.
+ */
+class FDeltacastDeinterlaceCS : public FGlobalShader
+{
+public:
+	DECLARE_EXPORTED_GLOBAL_SHADER(FDeltacastDeinterlaceCS, DELTACASTMEDIASHADERS_API);
+
+	SHADER_USE_PARAMETER_STRUCT(FDeltacastDeinterlaceCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, DeinterlaceFrame)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, DeinterlaceOutput)
+		SHADER_PARAMETER(FMatrix44f, DeinterlaceYuvToRgb)
+		SHADER_PARAMETER(FUintVector2, DeinterlaceFrameSize)
+		SHADER_PARAMETER(FUintVector2, DeinterlaceFieldFirstRow)
+		SHADER_PARAMETER(uint32, DeinterlaceStrideInWords)
+		SHADER_PARAMETER(uint32, DeinterlaceFieldRowStep)
+		SHADER_PARAMETER(uint32, DeinterlaceField)
+		SHADER_PARAMETER(uint32, DeinterlaceMode)
+		SHADER_PARAMETER(uint32, DeinterlaceFormat)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FDeltacastColorConversionParameters, ColorConversion)
+		SHADER_PARAMETER(float, DeinterlaceCombThreshold)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static constexpr int32 ThreadGroupSize = 8;
+
+	/** Values match the DEINTERLACE_MODE_* defines of the shader */
+	enum class EMode : uint32
+	{
+		Bob,
+		Weave,
+		IntraFrameAdaptive,
+	};
+
+	/** Values match the DEINTERLACE_FORMAT_* defines of the shader */
+	enum class EFormat : uint32
+	{
+		BGRA8,
+		UYVY8,
+		V210,
+		RGB10,
+		RGBA16,
+	};
+
+	/** Layout of the interlaced frame in the capture buffer and field to output */
+	struct FDesc
+	{
+		/** Full frame size in pixels, the output texture size */
+		FUintVector2 FrameSize;
+		uint32       Stride = 0;
+
+		/** Buffer row of the first line of the top and bottom fields, and number of buffer rows between two lines of a field */
+		uint32 TopFieldFirstRow    = 0;
+		uint32 BottomFieldFirstRow = 1;
+		uint32 FieldRowStep        = 2;
+
+		bool    bIsTopField = true;
+		EMode   Mode        = EMode::IntraFrameAdaptive;
+		EFormat Format      = EFormat::UYVY8;
+
+		/** Unused for the RGB formats */
+		FMatrix YuvToRgb;
+		FVector YuvOffset;
+
+		/** Decoding to linear after the YUV matrix */
+		FDeltacastColorConversion ColorConversion;
+
+		/** Normalized difference between the woven and interpolated lines above which the line is considered combing */
+		float CombThreshold = 0.04f;
+	};
+
+public:
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters);
+
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment);
+
+	/** Allocates and setup shader parameter in the incoming graph builder */
+	DELTACASTMEDIASHADERS_API FDeltacastDeinterlaceCS::FParameters* AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGBufferRef FrameBuffer, const FDesc& Desc, FRDGTextureRef OutputTexture);
+};
+
+/**
+ * Pixel shader to split a quad link frame into the four link ordered sub images, stacked from link 1 at the top to link 4 at the bottom
+ */
+class FDeltacastQuadLinkSplitPS : public FGlobalShader
+{
+public:
+	DECLARE_EXPORTED_GLOBAL_SHADER(FDeltacastQuadLinkSplitPS, DELTACASTMEDIASHADERS_API);
+
+	SHADER_USE_PARAMETER_STRUCT(FDeltacastQuadLinkSplitPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, QuadLinkInput)
+		SHADER_PARAMETER(FIntPoint, QuadLinkInputMin)
+		SHADER_PARAMETER(FUintVector2, QuadLinkSubImageSize)
+		SHADER_PARAMETER(uint32, QuadLinkMode)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+
+	/** Values match the QUADLINK_MODE_* defines of the shader */
+	enum class EMode : uint32
+	{
+		Quadrant,
+		TwoSampleInterleaved,
+	};
+
+public:
+	/** Allocates and setup shader parameter in the incoming graph builder, the output texture is the input rectangle half as wide and twice as high */
+	DELTACASTMEDIASHADERS_API FDeltacastQuadLinkSplitPS::FParameters* AllocateAndSetParameters(FRDGBuilder& GraphBuilder, FRDGTextureRef InputTexture, const FIntRect& InputRect, EMode Mode, FRDGTextureRef OutputTexture);
+};
\ No newline at end of file
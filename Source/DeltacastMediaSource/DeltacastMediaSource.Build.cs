@@ -54,6 +54,7 @@ public class DeltacastMediaSource : ModuleRules
 			{
 				"CoreUObject",
 				"DeltacastMedia",
+				"DeltacastMediaShaders",
 				"Engine",
 				"Projects",
 				"RenderCore",
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastDeinterlacer.h"
+
+#include "GlobalShader.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderTargetPool.h"
+
+
+
+void FDeltacastDeinterlacer::Setup(const FDeltacastFrameBufferPtr &InFrameBuffer, const FDeltacastDeinterlaceCS::FDesc &InDesc)
+{
+	FrameBuffer = InFrameBuffer;
+	Desc        = InDesc;
+}
+
+void FDeltacastDeinterlacer::Reset()
+{
+	FrameBuffer.Reset();
+}
+
+
+bool FDeltacastDeinterlacer::Convert(FRHICommandListImmediate &RHICmdList, FTextureRHIRef &InDstTexture, const FConversionHints &Hints)
+{
+	if (!FrameBuffer.IsValid() || !InDstTexture.IsValid())
+	{
+		return false;
+	}
+
+	FRDGBuilder GraphBuilder(RHICmdList);
+
+	// The whole frame is uploaded, both fields are read. The buffer outlives the graph as the sample holds it during the conversion.
+	const auto WordCount   = Desc.FrameSize.Y * Desc.Stride / sizeof(uint32);
+	const auto InputBuffer = CreateStructuredBuffer(GraphBuilder, TEXT("DeltacastDeinterlaceFrame"), sizeof(uint32), WordCount,
+	                                                FrameBuffer->GetData(), WordCount * sizeof(uint32), ERDGInitialDataFlags::NoCopy);
+
+	const auto OutputTexture = GraphBuilder.RegisterExternalTexture(CreateRenderTarget(InDstTexture, TEXT("DeltacastDeinterlaceOutput")));
+
+	const TShaderMapRef<FDeltacastDeinterlaceCS> ComputeShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+
+	const auto Parameters = ComputeShader->AllocateAndSetParameters(GraphBuilder, InputBuffer, Desc, OutputTexture);
+	const auto GroupCount = FComputeShaderUtils::GetGroupCount(FIntPoint(Desc.FrameSize.X, Desc.FrameSize.Y), FDeltacastDeinterlaceCS::ThreadGroupSize);
+
+	FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("DeltacastDeinterlace"), ComputeShader, Parameters, GroupCount);
+
+	GraphBuilder.SetTextureAccessFinal(OutputTexture, ERHIAccess::SRVMask);
+	GraphBuilder.Execute();
+
+	return true;
+}
@@ -0,0 +1,47 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "DeltacastFrameArena.h"
+#include "DeltacastMediaShaders.h"
+#include "IMediaTextureSampleConverter.h"
+
+
+/**
+ * Converts one field of an interlaced frame to a full height progressive texture on the GPU.
+ * The frame buffer is uploaded as captured, the fields are split and the missing lines rebuilt by a compute pass.
+ */
+class FDeltacastDeinterlacer final : public IMediaTextureSampleConverter
+{
+public:
+	void Setup(const FDeltacastFrameBufferPtr &InFrameBuffer, const FDeltacastDeinterlaceCS::FDesc &InDesc);
+
+	void Reset();
+
+	[[nodiscard]] bool IsSet() const { return FrameBuffer.IsValid(); }
+
+public: //~ IMediaTextureSampleConverter
+	virtual bool Convert(FRHICommandListImmediate &RHICmdList, FTextureRHIRef &InDstTexture, const FConversionHints &Hints) override;
+
+	virtual uint32 GetConverterInfoFlags() const override
+	{
+		return ConverterInfoFlags_NeedUAVOutputTexture;
+	}
+
+private:
+	FDeltacastFrameBufferPtr       FrameBuffer;
+	FDeltacastDeinterlaceCS::FDesc Desc;
+};
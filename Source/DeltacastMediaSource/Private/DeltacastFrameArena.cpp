@@ -0,0 +1,272 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastFrameArena.h"
+
+#include "IDeltacastMediaSourceModule.h"
+#include "Misc/ScopeLock.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include <Windows.h>
+#include <Psapi.h>
+#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_LINUX
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+
+namespace
+{
+	constexpr uint64 LargePageSize = 2 * 1024 * 1024;
+	constexpr uint64 BlockAlignment = 4096;
+
+	struct FArenaMemory
+	{
+		uint8* Memory = nullptr;
+		uint64 Size   = 0;
+
+		bool bUsesLargePages = false;
+	};
+
+#if PLATFORM_LINUX
+	// `numaif.h` is not part of the toolchain, the memory policy is set with the raw system call
+	constexpr int MemoryPolicyPreferred = 1;
+
+	uint64 GetPageFaultCount()
+	{
+		rusage Usage{};
+		return getrusage(RUSAGE_THREAD, &Usage) == 0 ? static_cast<uint64>(Usage.ru_minflt + Usage.ru_majflt) : 0;
+	}
+#elif PLATFORM_WINDOWS
+	uint64 GetPageFaultCount()
+	{
+		PROCESS_MEMORY_COUNTERS Counters{};
+		return GetProcessMemoryInfo(GetCurrentProcess(), &Counters, sizeof(Counters)) ? Counters.PageFaultCount : 0;
+	}
+#else
+	uint64 GetPageFaultCount()
+	{
+		return 0;
+	}
+#endif
+
+	FArenaMemory AllocateArenaMemory(const uint64 Size, const int32 NumaNode)
+	{
+		FArenaMemory Arena;
+		Arena.Size = Align(Size, LargePageSize);
+
+#if PLATFORM_WINDOWS
+		const auto PreferredNode = NumaNode >= 0 ? static_cast<DWORD>(NumaNode) : NUMA_NO_PREFERRED_NODE;
+
+		// Large pages need the "Lock pages in memory" privilege
+		const auto LargePageMinimum = GetLargePageMinimum();
+		if (LargePageMinimum != 0)
+		{
+			const auto LargePageArenaSize = Align(Size, static_cast<uint64>(LargePageMinimum));
+
+			Arena.Memory = static_cast<uint8*>(VirtualAllocExNuma(GetCurrentProcess(), nullptr, LargePageArenaSize,
+			                                                      MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, PreferredNode));
+			if (Arena.Memory != nullptr)
+			{
+				Arena.Size            = LargePageArenaSize;
+				Arena.bUsesLargePages = true;
+				return Arena;
+			}
+		}
+
+		Arena.Memory = static_cast<uint8*>(VirtualAllocExNuma(GetCurrentProcess(), nullptr, Arena.Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, PreferredNode));
+#elif PLATFORM_LINUX
+		// Explicit huge pages when reserved by the administrator, transparent huge pages otherwise
+		auto Memory = mmap(nullptr, Arena.Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		Arena.bUsesLargePages = Memory != MAP_FAILED;
+
+		if (Memory == MAP_FAILED)
+		{
+			Memory = mmap(nullptr, Arena.Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (Memory == MAP_FAILED)
+			{
+				return {};
+			}
+
+			Arena.bUsesLargePages = madvise(Memory, Arena.Size, MADV_HUGEPAGE) == 0;
+		}
+
+		if (NumaNode >= 0 && NumaNode < 64)
+		{
+			const unsigned long NodeMask = 1ul << NumaNode;
+			if (syscall(SYS_mbind, Memory, Arena.Size, MemoryPolicyPreferred, &NodeMask, sizeof(NodeMask) * 8, 0) != 0)
+			{
+				UE_LOG(LogDeltacastMediaSource, Warning, TEXT("Cannot place the frame arena on NUMA node %d"), NumaNode);
+			}
+		}
+
+		Arena.Memory = static_cast<uint8*>(Memory);
+#else
+		Arena.Memory = static_cast<uint8*>(FMemory::Malloc(Arena.Size, LargePageSize));
+#endif
+
+		return Arena;
+	}
+
+	void FreeArenaMemory(uint8* const Memory, const uint64 Size)
+	{
+#if PLATFORM_WINDOWS
+		VirtualFree(Memory, 0, MEM_RELEASE);
+#elif PLATFORM_LINUX
+		munmap(Memory, Size);
+#else
+		FMemory::Free(Memory);
+#endif
+	}
+}
+
+
+
+FDeltacastFrameArenaPtr FDeltacastFrameArena::Create(const uint32 BlockCount, const uint64 BlockSize, const int32 NumaNode)
+{
+	if (BlockCount == 0 || BlockSize == 0)
+	{
+		return nullptr;
+	}
+
+	const auto AlignedBlockSize = Align(BlockSize, BlockAlignment);
+
+	const auto ArenaMemory = AllocateArenaMemory(AlignedBlockSize * BlockCount, NumaNode);
+	if (ArenaMemory.Memory == nullptr)
+	{
+		UE_LOG(LogDeltacastMediaSource, Warning, TEXT("Cannot reserve a frame arena of %u x %llu bytes"), BlockCount, AlignedBlockSize);
+		return nullptr;
+	}
+
+	// Commit every page now, on the thread opening the player, so that the capture thread never faults
+	const auto PageFaultCountBefore = GetPageFaultCount();
+	FMemory::Memzero(ArenaMemory.Memory, ArenaMemory.Size);
+	const auto PageFaultCountAfter = GetPageFaultCount();
+
+	TSharedPtr<FDeltacastFrameArena, ESPMode::ThreadSafe> Arena(new FDeltacastFrameArena());
+	Arena->Memory     = ArenaMemory.Memory;
+	Arena->MemorySize = ArenaMemory.Size;
+
+	Arena->Stats.BlockCount      = BlockCount;
+	Arena->Stats.BlockSize       = AlignedBlockSize;
+	Arena->Stats.NumaNode        = NumaNode;
+	Arena->Stats.bUsesLargePages = ArenaMemory.bUsesLargePages;
+	Arena->Stats.PageFaultCount  = PageFaultCountAfter - PageFaultCountBefore;
+
+	Arena->FreeBlocks.Reserve(BlockCount);
+	for (int64 BlockIndex = BlockCount - 1; BlockIndex >= 0; --BlockIndex)
+	{
+		Arena->FreeBlocks.Add(Arena->Memory + BlockIndex * AlignedBlockSize);
+	}
+
+	UE_LOG(LogDeltacastMediaSource, Log, TEXT("Frame arena: %u x %llu bytes, NUMA node %d, %s pages, %llu page faults to commit"),
+	       BlockCount, AlignedBlockSize, NumaNode, ArenaMemory.bUsesLargePages ? TEXT("large") : TEXT("regular"), Arena->Stats.PageFaultCount);
+
+	return Arena;
+}
+
+FDeltacastFrameArena::~FDeltacastFrameArena()
+{
+	ensureMsgf(FreeBlocks.Num() == static_cast<int32>(Stats.BlockCount), TEXT("Frame arena released with blocks in use"));
+
+	FreeArenaMemory(Memory, MemorySize);
+}
+
+
+uint8* FDeltacastFrameArena::Allocate(const uint64 Size)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	if (Size > Stats.BlockSize || FreeBlocks.IsEmpty())
+	{
+		++Stats.FallbackCount;
+		return nullptr;
+	}
+
+	++Stats.AllocationCount;
+	++Stats.BlocksInUse;
+
+	return FreeBlocks.Pop(EAllowShrinking::No);
+}
+
+void FDeltacastFrameArena::Release(uint8* const Block)
+{
+	check(Block >= Memory && Block < Memory + MemorySize);
+
+	FScopeLock Lock(&CriticalSection);
+
+	--Stats.BlocksInUse;
+
+	FreeBlocks.Add(Block);
+}
+
+FDeltacastFrameArena::FStats FDeltacastFrameArena::GetStats() const
+{
+	FScopeLock Lock(&CriticalSection);
+
+	return Stats;
+}
+
+
+
+FDeltacastFrameBufferPtr FDeltacastFrameBuffer::FromArena(const FDeltacastFrameArenaPtr& Arena, const uint64 Size)
+{
+	if (!Arena.IsValid())
+	{
+		return nullptr;
+	}
+
+	const auto Block = Arena->Allocate(Size);
+	if (Block == nullptr)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FDeltacastFrameBuffer, ESPMode::ThreadSafe> FrameBuffer(new FDeltacastFrameBuffer());
+	FrameBuffer->Data  = Block;
+	FrameBuffer->Arena = Arena;
+
+	return FrameBuffer;
+}
+
+TSharedRef<FDeltacastFrameBuffer, ESPMode::ThreadSafe> FDeltacastFrameBuffer::Allocate(const FDeltacastFrameArenaPtr& Arena, const uint64 Size)
+{
+	if (auto FrameBuffer = FromArena(Arena, Size))
+	{
+		return FrameBuffer.ToSharedRef();
+	}
+
+	TSharedRef<FDeltacastFrameBuffer, ESPMode::ThreadSafe> FrameBuffer(new FDeltacastFrameBuffer());
+	FrameBuffer->Data = static_cast<uint8*>(FMemory::Malloc(Size, BlockAlignment));
+
+	return FrameBuffer;
+}
+
+FDeltacastFrameBuffer::~FDeltacastFrameBuffer()
+{
+	if (Arena.IsValid())
+	{
+		Arena->Release(Data);
+	}
+	else
+	{
+		FMemory::Free(Data);
+	}
+}
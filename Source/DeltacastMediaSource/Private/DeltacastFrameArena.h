@@ -0,0 +1,122 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+
+
+
+/**
+ * Fixed set of frame sized blocks for the texture samples of one media player.
+ * The memory is committed up front on the NUMA node of the board, with 2 MB pages when the system provides them.
+ * Samples keep a reference to the arena, it is released once the player is closed and the last sample is recycled.
+ */
+class FDeltacastFrameArena final
+{
+public:
+	struct FStats
+	{
+		uint32 BlockCount = 0;
+		uint64 BlockSize  = 0;
+
+		uint32 BlocksInUse = 0;
+
+		/** NUMA node requested for the memory, -1 when none */
+		int32 NumaNode        = -1;
+		bool  bUsesLargePages = false;
+
+		/** Blocks handed out */
+		uint64 AllocationCount = 0;
+
+		/** Requests served by the general allocator, the arena was exhausted or the frame larger than a block */
+		uint64 FallbackCount = 0;
+
+		/** Page faults taken while committing the arena, none are taken when capturing into it */
+		uint64 PageFaultCount = 0;
+	};
+
+public:
+	/** nullptr when the memory cannot be reserved */
+	[[nodiscard]] static TSharedPtr<FDeltacastFrameArena, ESPMode::ThreadSafe> Create(uint32 BlockCount, uint64 BlockSize, int32 NumaNode);
+
+	~FDeltacastFrameArena();
+
+	FDeltacastFrameArena(const FDeltacastFrameArena &Other)     = delete;
+	FDeltacastFrameArena(FDeltacastFrameArena &&Other) noexcept = delete;
+
+	FDeltacastFrameArena &operator=(const FDeltacastFrameArena &Other)     = delete;
+	FDeltacastFrameArena &operator=(FDeltacastFrameArena &&Other) noexcept = delete;
+
+public:
+	/** nullptr when no block is free or the size exceeds a block, the caller then uses the general allocator */
+	[[nodiscard]] uint8* Allocate(uint64 Size);
+	void Release(uint8* Block);
+
+	[[nodiscard]] FStats GetStats() const;
+
+private:
+	FDeltacastFrameArena() = default;
+
+private:
+	uint8* Memory     = nullptr;
+	uint64 MemorySize = 0;
+
+	mutable FCriticalSection CriticalSection;
+
+	TArray<uint8*> FreeBlocks;
+
+	FStats Stats;
+};
+
+using FDeltacastFrameArenaPtr = TSharedPtr<FDeltacastFrameArena, ESPMode::ThreadSafe>;
+
+
+/**
+ * Frame memory shared by the samples showing it, an arena block returns to the arena with the last reference
+ */
+class FDeltacastFrameBuffer final
+{
+public:
+	/** nullptr when the arena cannot serve the size */
+	[[nodiscard]] static TSharedPtr<FDeltacastFrameBuffer, ESPMode::ThreadSafe> FromArena(const FDeltacastFrameArenaPtr& Arena, uint64 Size);
+
+	/** From the arena when possible, from the general allocator otherwise */
+	[[nodiscard]] static TSharedRef<FDeltacastFrameBuffer, ESPMode::ThreadSafe> Allocate(const FDeltacastFrameArenaPtr& Arena, uint64 Size);
+
+	~FDeltacastFrameBuffer();
+
+	FDeltacastFrameBuffer(const FDeltacastFrameBuffer &Other)     = delete;
+	FDeltacastFrameBuffer(FDeltacastFrameBuffer &&Other) noexcept = delete;
+
+	FDeltacastFrameBuffer &operator=(const FDeltacastFrameBuffer &Other)     = delete;
+	FDeltacastFrameBuffer &operator=(FDeltacastFrameBuffer &&Other) noexcept = delete;
+
+public:
+	[[nodiscard]] uint8* GetData() const { return Data; }
+
+private:
+	FDeltacastFrameBuffer() = default;
+
+private:
+	uint8* Data = nullptr;
+
+	/** Owner of the block, empty when allocated from the general allocator */
+	FDeltacastFrameArenaPtr Arena;
+};
+
+using FDeltacastFrameBufferPtr = TSharedPtr<FDeltacastFrameBuffer, ESPMode::ThreadSafe>;
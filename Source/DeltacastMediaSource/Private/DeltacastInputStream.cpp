@@ -28,6 +28,7 @@ FDeltacastInputStream::FDeltacastInputStream(const FDeltacastInputStreamConfig &
 	  SdiPortConfig(Config.SdiPortConfig),
 	  DvPortConfig(Config.DvPortConfig),
 	  bAutoLoadEdid(Config.bAutoLoadEdid),
+	  Colorimetry(Config.Colorimetry),
 	  TimecodeFormat(Config.TimecodeFormat),
 	  bErrorOnSourceLost(Config.bErrorOnSourceLost)
 {
@@ -37,6 +38,21 @@ FDeltacastInputStream::FDeltacastInputStream(const FDeltacastInputStreamConfig &
 	StreamStatistics.bUpdateDroppedFrameCount   = Config.bLogDroppedFrameCount;
 	StreamStatistics.bUpdateBufferFill          = false;
 	StreamStatistics.NumberOfDeltacastBuffers   = BasePortConfig().BufferDepth;
+
+	if (Config.bAdaptiveBufferDepth)
+	{
+		FDeltacastBufferDepthController::FConfig ControllerConfig;
+		ControllerConfig.MinimumDepth = BasePortConfig().BufferDepth;
+		ControllerConfig.MaximumDepth = FMath::Max(Config.MaximumBufferDepth, ControllerConfig.MinimumDepth);
+		ControllerConfig.bIsInput     = true;
+
+		BufferDepthController.emplace(ControllerConfig);
+
+		StreamStatistics.bUpdateDroppedFrameCount = true;
+		StreamStatistics.bUpdateBufferFill        = true;
+	}
+
+	ComputeConstants();
 }
 
 
@@ -46,15 +62,16 @@ bool FDeltacastInputStream::Init()
 
 	const auto& BaseConfig = BasePortConfig();
 
-	BoardHandle = DeltacastSdk.OpenBoard(BaseConfig.BoardIndex).value_or(VHD::InvalidHandle);
-	if (BoardHandle == VHD::InvalidHandle)
+	Board = FDeltacast::GetBoardRegistry().Acquire(BaseConfig.BoardIndex);
+	if (!Board.IsValid())
 	{
 		Callback->OnInitializationCompleted(false);
 		Exit();
 		return false;
 	}
 
-	ComputeConstants();
+	BoardHandle = Board->GetHandle();
+
 	ComputeTimecodeSource();
 	RegisterSettingsEvent();
 
@@ -118,7 +135,7 @@ bool FDeltacastInputStream::Init()
 		[[maybe_unused]] const auto SetInterlacedResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_INTERLACED, VideoCharacteristics->bIsInterlaced);
 		[[maybe_unused]] const auto SetRefreshRateResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_REFRESH_RATE, VideoCharacteristics->FrameRate);
 
-		Deltacast::Helpers::FCablePacking CablePacking(BaseConfig.BufferPacking, Deltacast::Helpers::IsSd(DvPortConfig.VideoStandard));
+		Deltacast::Helpers::FCablePacking CablePacking(BaseConfig.BufferPacking, Deltacast::Helpers::IsSd(DvPortConfig.VideoStandard), Colorimetry);
 
 		[[maybe_unused]] const auto SetColorSpaceResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_DV_STREAMPROPERTY::VHD_DV_SP_CS, static_cast<VHD::ULONG>(CablePacking.ColorSpace));
 	}
@@ -142,7 +159,7 @@ bool FDeltacastInputStream::Init()
 
 	if (bInterlaced)
 	{
-		bFieldMergingSupported = DeltacastSdk.IsFieldMergingSupported(BoardHandle).value_or(false);
+		bFieldMergingSupported = Board->GetInfo().bIsFieldMergingSupported;
 
 		if (bFieldMergingSupported)
 		{
@@ -154,6 +171,10 @@ bool FDeltacastInputStream::Init()
 				bFieldMergingSupported = false;
 			}
 		}
+
+		// Merged by the board, the frame lines are in transmission order: 525 line standards send the bottom field first.
+		// Not merged, the slot buffer holds the first field then the second one and the first field is read as the bottom field.
+		bTopFieldFirst = bFieldMergingSupported && Height != 480 && Height != 486;
 	}
 
 	const auto StartStreamResult = DeltacastSdk.StartStream(StreamHandle);
@@ -255,6 +276,7 @@ uint32 FDeltacastInputStream::Run()
 		auto RequestedBuffer = FDeltacastRequestedBuffer{};
 		auto RequestBuffer = FDeltacastRequestBuffer{};
 		RequestBuffer.VideoBufferSize = BufferSize;
+		RequestBuffer.bIsProgressive  = !bInterlaced;
 
 		if (Callback->OnRequestInputBuffer(RequestBuffer, RequestedBuffer))
 		{
@@ -266,7 +288,9 @@ uint32 FDeltacastInputStream::Run()
 			VideoFrameData.Height = Height;
 			VideoFrameData.Stride = Stride;
 
-			VideoFrameData.bIsProgressive = !bInterlaced;
+			VideoFrameData.bIsProgressive    = !bInterlaced;
+			VideoFrameData.bIsTopFieldFirst  = bTopFieldFirst;
+			VideoFrameData.bIsFieldSeparated = bInterlaced && !bFieldMergingSupported;
 
 			VideoFrameData.MetaData.Timecode = Timecode;
 
@@ -276,28 +300,7 @@ uint32 FDeltacastInputStream::Run()
 
 			if (RequestedBuffer.VideoBuffer != nullptr)
 			{
-				if (bInterlaced && !bFieldMergingSupported)
-				{
-					const auto &EngineBuffer = RequestedBuffer.VideoBuffer;
-					const auto  BytesPerRow  = Stride;
-
-					const auto C = Height / 2;
-					for (uint32 Row = 0; Row < Height; Row += 2)
-					{
-						const auto SourceEvenLine = Buffer + (((Row / 2) + C) * BytesPerRow);
-						const auto SourceOddLine  = Buffer + (((Row / 2) + 0) * BytesPerRow);
-
-						const auto DestinationEvenLine = EngineBuffer + ((Row + 0) * BytesPerRow);
-						const auto DestinationOddLine  = EngineBuffer + ((Row + 1) * BytesPerRow);
-
-						std::memcpy(DestinationEvenLine, SourceEvenLine, BytesPerRow);
-						std::memcpy(DestinationOddLine, SourceOddLine, BytesPerRow);
-					}
-				}
-				else
-				{
-					FMemory::Memcpy(RequestedBuffer.VideoBuffer, Buffer, BufferSize);
-				}
+				FMemory::Memcpy(RequestedBuffer.VideoBuffer, Buffer, BufferSize);
 
 				VideoFrameData.VideoBuffer = RequestedBuffer.VideoBuffer;
 
@@ -321,6 +324,12 @@ uint32 FDeltacastInputStream::Run()
 		}
 
 		Deltacast::Helpers::GetStreamStatistics(StreamStatistics, StreamHandle);
+
+		if (BufferDepthController.has_value() && !UpdateBufferDepth())
+		{
+			bSourceError = true;
+			break;
+		}
 	}
 
 	return 0;
@@ -339,12 +348,12 @@ void FDeltacastInputStream::Exit()
 
 		DeltacastSdk.SetLoopbackState(BoardHandle, BasePortConfig().PortIndex, (!bIsSdi || SdiPortConfig.IsSingleLink()) ? 1 : 4, VHD::True);
 
-		[[maybe_unused]] const auto CloseBoardHandleResult = DeltacastSdk.CloseBoardHandle(BoardHandle);
-		BoardHandle = VHD::InvalidHandle;
-
 		StreamStatistics.Reset();
 	}
 
+	BoardHandle = VHD::InvalidHandle;
+	Board.Reset();
+
 	Callback->OnCompletion(!bSourceError);
 }
 
@@ -374,6 +383,42 @@ void FDeltacastInputStream::WaitForChannelLocked(const VHD_CORE_BOARDPROPERTY Ch
 }
 
 
+bool FDeltacastInputStream::UpdateBufferDepth()
+{
+	const auto Adjustment = BufferDepthController->Update(StreamStatistics.DroppedFrameCount, StreamStatistics.FilledSlotCount, FPlatformTime::Seconds());
+	if (!Adjustment.has_value())
+	{
+		return true;
+	}
+
+	UE_LOG(LogDeltacastMediaSource, Display, TEXT("Changing the buffer depth of media '%s' from %u to %u: %s"),
+	       *ConfigString(), Adjustment->PreviousDepth, Adjustment->Depth, Adjustment->Reason);
+
+	auto& DeltacastSdk = FDeltacast::GetSdk();
+
+	// The queue depth is only taken into account when the stream starts
+	[[maybe_unused]] const auto StopStreamResult = DeltacastSdk.StopStream(StreamHandle);
+
+	const auto SetBufferQueueDepthResult = DeltacastSdk.SetStreamProperty(StreamHandle, VHD_CORE_STREAMPROPERTY::VHD_CORE_SP_BUFFERQUEUE_DEPTH, Adjustment->Depth);
+	UE_CLOG(!Deltacast::Helpers::IsValid(SetBufferQueueDepthResult), LogDeltacastMediaSource, Warning,
+	        TEXT("Failed to set the buffer depth of media '%s': %s"), *ConfigString(), *Deltacast::Helpers::GetErrorString(SetBufferQueueDepthResult));
+
+	const auto StartStreamResult = DeltacastSdk.StartStream(StreamHandle);
+	if (!Deltacast::Helpers::IsValid(StartStreamResult))
+	{
+		UE_LOG(LogDeltacastMediaSource, Error, TEXT("Failed to restart the stream of media '%s': %s"), *ConfigString(), *Deltacast::Helpers::GetErrorString(StartStreamResult));
+		return false;
+	}
+
+	StreamStatistics.Reset();
+	StreamStatistics.NumberOfDeltacastBuffers = Adjustment->Depth;
+
+	Callback->OnBufferDepthChanged(Adjustment->Depth);
+
+	return true;
+}
+
+
 void FDeltacastInputStream::ComputeConstants()
 {
 	const auto VideoCharacteristics = bIsSdi
@@ -395,9 +440,13 @@ void FDeltacastInputStream::ComputeConstants()
 	
 	switch (BaseConfig.BufferPacking)
 	{
-		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_32:
+		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_32: [[fallthrough]];
+		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30:
 			Stride = VideoCharacteristics->Width * 4;
 			break;
+		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64:
+			Stride = VideoCharacteristics->Width * 8;
+			break;
 		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8:
 			Stride = VideoCharacteristics->Width * 2;
 			break;
@@ -18,8 +18,11 @@
 #if WITH_EDITOR
 #include "Delegates/IDelegateInstance.h"
 #endif
+#include "DeltacastBoardRegistry.h"
+#include "DeltacastBufferDepthController.h"
 #include "DeltacastDefinition.h"
 #include "DeltacastDeviceScanner.h"
+#include "DeltacastMediaColor.h"
 #include "DeltacastMediaSettings.h"
 #include "DeltacastMediaTextureSample.h"
 #include "MediaIOCoreDefinitions.h"
@@ -55,6 +58,9 @@ public:
 	virtual void OnSourceResumed() = 0;
 	virtual void OnSourceStopped() = 0;
 
+	/** The stream was restarted with a new buffer queue depth by the adaptive buffer depth controller */
+	virtual void OnBufferDepthChanged(uint32 BufferDepth) = 0;
+
 	virtual void OnCompletion(bool bSucceed) = 0;
 };
 
@@ -69,10 +75,17 @@ struct FDeltacastInputStreamConfig final
 
 	bool bAutoLoadEdid = true;
 
+	/** Color space announced on DV inputs */
+	EDeltacastColorimetry Colorimetry = EDeltacastColorimetry::Auto;
+
 	bool bErrorOnSourceLost = true;
 
 	bool bLogDroppedFrameCount = false;
 
+	/** The stream starts with the base port config buffer depth and may grow up to the maximum depth */
+	bool   bAdaptiveBufferDepth = false;
+	uint32 MaximumBufferDepth   = 0;
+
 	EMediaIOTimecodeFormat TimecodeFormat = EMediaIOTimecodeFormat::None;
 };
 
@@ -90,9 +103,17 @@ public: //~ FRunnable
 
 	virtual void Stop() override;
 
+public:
+	/** Size of a captured frame in the engine buffers */
+	[[nodiscard]] uint32 GetFrameSize() const { return Stride * Height; }
+	[[nodiscard]] uint32 GetStride() const { return Stride; }
+
 private:
 	void WaitForChannelLocked(VHD_CORE_BOARDPROPERTY ChannelStatus) const;
 
+	/** Feeds the statistics of the last frame to the buffer depth controller and restarts the stream when the depth changes, false on failure */
+	[[nodiscard]] bool UpdateBufferDepth();
+
 	void ComputeConstants();
 	void ComputeTimecodeSource();
 
@@ -131,6 +152,8 @@ private:
 
 	bool bAutoLoadEdid = true;
 
+	EDeltacastColorimetry Colorimetry = EDeltacastColorimetry::Auto;
+
 	EMediaIOTimecodeFormat TimecodeFormat = EMediaIOTimecodeFormat::None;
 	VHD_TIMECODE_SOURCE    TimecodeSource = VHD_TIMECODE_SOURCE::NB_VHD_TC_SRC;
 
@@ -142,12 +165,17 @@ private:
 private:
 	Deltacast::Helpers::FStreamStatistics StreamStatistics;
 
+	std::optional<FDeltacastBufferDepthController> BufferDepthController;
+
 	bool bInterlaced            = false;
 	bool bFieldMergingSupported = false;
+	bool bTopFieldFirst         = true;
 
 	bool bErrorOnSourceLost = true;
 
 private:
+	FDeltacastBoardRef Board;
+
 	VHDHandle BoardHandle  = VHD::InvalidHandle;
 	VHDHandle StreamHandle = VHD::InvalidHandle;
 };
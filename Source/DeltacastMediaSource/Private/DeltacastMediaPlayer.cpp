@@ -19,8 +19,10 @@
 #include "DeltacastHelpers.h"
 #include "DeltacastInputStream.h"
 #include "DeltacastMediaOption.h"
+#include "DeltacastMediaSettings.h"
 #include "DeltacastMediaSource.h"
 #include "DeltacastSdk.h"
+#include "DeltacastThread.h"
 #include "IDeltacastMediaModule.h"
 #include "IDeltacastMediaSourceModule.h"
 #include "IMediaEventSink.h"
@@ -32,6 +34,8 @@
 #include "MediaIOCoreSamples.h"
 #include "MediaIOCorePlayerBase.h"
 
+#include <optional>
+
 
 #define LOCTEXT_NAMESPACE "FDeltacastMediaPlayer"
 
@@ -45,6 +49,24 @@ static FAutoConsoleCommand DeltacastWriteOutputRawDataCmd(
 	FConsoleCommandDelegate::CreateLambda([]() { bDeltacastMediaSourceWriteOutputRawDataCmdEnable = true; })
 );
 
+/** Capacity of the sample pool relative to the prewarmed samples, leaves room for the samples acquired by the MediaIO render path */
+static constexpr int32 SamplePoolCapacityFactor = 2;
+
+
+std::optional<FDeltacastDeinterlaceCS::EMode> DeinterlaceModeToShaderMode(const EDeltacastDeinterlaceMode DeinterlaceMode)
+{
+	switch (DeinterlaceMode)
+	{
+	case EDeltacastDeinterlaceMode::Bob:
+		return FDeltacastDeinterlaceCS::EMode::Bob;
+	case EDeltacastDeinterlaceMode::Weave:
+		return FDeltacastDeinterlaceCS::EMode::Weave;
+	case EDeltacastDeinterlaceMode::IntraFrameAdaptive:
+		return FDeltacastDeinterlaceCS::EMode::IntraFrameAdaptive;
+	default:
+		return {};
+	}
+}
 
 VHD_BUFFERPACKING SourcePixelFormatToDcBufferPacking(const EDeltacastMediaSourcePixelFormat PixelFormat)
 {
@@ -56,6 +78,10 @@ VHD_BUFFERPACKING SourcePixelFormatToDcBufferPacking(const EDeltacastMediaSource
 		return VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8;
 	case EDeltacastMediaSourcePixelFormat::PF_10BIT_YUV422:
 		return VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_10;
+	case EDeltacastMediaSourcePixelFormat::PF_10BIT_RGB:
+		return VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30;
+	case EDeltacastMediaSourcePixelFormat::PF_10BIT_RGBA:
+		return VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64;
 	default:
 		UE_LOG(LogDeltacastMediaSource, Fatal, TEXT("Unhandled `EDeltacastMediaSourcePixelFormat`: %d"), PixelFormat);
 		return VHD_BUFFERPACKING{};
@@ -97,7 +123,14 @@ bool FDeltacastMediaPlayer::Open(const FString &Url, const IMediaOptions *Option
 
 	const auto BoardIndex  = Options->GetMediaOption(DeltacastMediaOption::BoardIndex, int64{ 0 });
 	const auto PortIndex   = Options->GetMediaOption(DeltacastMediaOption::PortIndex, int64{ 0 });
-	const auto BufferDepth = Options->GetMediaOption(DeltacastMediaOption::NumberOfDeltacastBuffers, int64{ 8 });
+	MaxBufferDepth = static_cast<uint32>(Options->GetMediaOption(DeltacastMediaOption::NumberOfDeltacastBuffers, int64{ 8 }));
+
+	bAdaptiveBufferDepth = Options->GetMediaOption(DeltacastMediaOption::AdaptiveBufferDepth, false);
+
+	const auto BufferDepth = bAdaptiveBufferDepth
+		                         ? static_cast<uint32>(Options->GetMediaOption(DeltacastMediaOption::MinimumNumberOfDeltacastBuffers, int64{ 2 }))
+		                         : MaxBufferDepth;
+	ThreadBufferDepth = BufferDepth;
 
 	const auto LinkType      = static_cast<EMediaIOTransportType>(Options->GetMediaOption(DeltacastMediaOption::LinkType, int64{ 0 }));
 	const auto QuadLinkType  = static_cast<EMediaIOQuadLinkTransportType>(Options->GetMediaOption(DeltacastMediaOption::QuadLinkType, int64{ 0 }));
@@ -143,14 +176,21 @@ bool FDeltacastMediaPlayer::Open(const FString &Url, const IMediaOptions *Option
 		}
 	}();
 
+	MaxVideoFrameBufferCount = Options->GetMediaOption(DeltacastMediaOption::NumberOfEngineBuffers, int64{ 8 });
+	VideoFrameBufferCount    = GetEngineBufferCount(BufferDepth);
+
 	SetupSampleChannels();
 
 	bEncodeTimecodeInTexel = Options->GetMediaOption(DeltacastMediaOption::EncodeTimecodeInTexel, false);
 	bIsSRGBInput           = Options->GetMediaOption(DeltacastMediaOption::IsSRGBInput, false);
 
 	BufferPacking            = SourcePixelFormatToDcBufferPacking(PixelFormat);
-	MaxVideoFrameBufferCount = Options->GetMediaOption(DeltacastMediaOption::NumberOfEngineBuffers, int64{ 8 });
 	bLogDroppedFrameCount = Options->GetMediaOption(DeltacastMediaOption::LogDroppedFrameCount, false);
+	DeinterlaceMode = static_cast<EDeltacastDeinterlaceMode>(Options->GetMediaOption(DeltacastMediaOption::DeinterlaceMode, static_cast<int64>(EDeltacastDeinterlaceMode::Off)));
+
+	VideoColor.Colorimetry        = static_cast<EDeltacastColorimetry>(Options->GetMediaOption(DeltacastMediaOption::Colorimetry, static_cast<int64>(EDeltacastColorimetry::Auto)));
+	VideoColor.TransferFunction   = static_cast<EDeltacastTransferFunction>(Options->GetMediaOption(DeltacastMediaOption::TransferFunction, static_cast<int64>(EDeltacastTransferFunction::SDR)));
+	VideoColor.ReferenceWhiteNits = static_cast<int32>(Options->GetMediaOption(DeltacastMediaOption::HdrReferenceWhiteNits, int64{ 100 }));
 
 	Samples->EnableTimedDataChannels(this, EMediaIOSampleType::Video);
 
@@ -197,15 +237,42 @@ bool FDeltacastMediaPlayer::Open(const FString &Url, const IMediaOptions *Option
 
 		Config.bAutoLoadEdid = bAutoLoadEdid;
 
+		Config.Colorimetry = VideoColor.Colorimetry;
+
 		Config.bErrorOnSourceLost = bErrorOnSourceLost;
 
 		Config.bLogDroppedFrameCount = bLogDroppedFrameCount;
 
+		Config.bAdaptiveBufferDepth = bAdaptiveBufferDepth;
+		Config.MaximumBufferDepth   = MaxBufferDepth;
+
 		return Config;
 	}();
 
 	InputChannel = MakeShared<FDeltacastInputStream>(InputStreamConfig);
-	Thread.Reset(FRunnableThread::Create(InputChannel.Get(), *FString::Printf(TEXT("Deltacast Media Player %s"), *GetMediaName().ToString())));
+
+	{
+		// Each interlaced frame is shown by two field samples sharing one block with an extra line for the bottom field reads.
+		// One more block for the frame being captured and the one being rendered.
+		const auto bIsInterlaced = InputStreamConfig.bIsSdi
+			                           ? !Deltacast::Helpers::IsProgressive(InputStreamConfig.SdiPortConfig.VideoStandard)
+			                           : !Deltacast::Helpers::IsProgressive(InputStreamConfig.DvPortConfig.VideoStandard);
+		const auto BlockCount  = MaxVideoFrameBufferCount + 2;
+		const auto BlockSize   = InputChannel->GetFrameSize() + (bIsInterlaced ? InputChannel->GetStride() : 0);
+		const auto SampleCount = static_cast<int32>(BlockCount * (bIsInterlaced ? 2 : 1));
+
+		const auto BoardSettings = GetDefault<UDeltacastMediaSettings>()->GetBoardSettings(static_cast<int32>(BoardIndex));
+		const auto NumaNode      = BoardSettings != nullptr ? BoardSettings->NumaNode : -1;
+
+		FrameArena = FDeltacastFrameArena::Create(BlockCount, BlockSize, NumaNode);
+
+		// The sample own buffers are only used for progressive frames when the arena is not available
+		const auto bCommitSampleBuffers = !FrameArena.IsValid() && !bIsInterlaced;
+		TextureSamplePool->Prewarm(SampleCount, SampleCount * SamplePoolCapacityFactor, bCommitSampleBuffers ? InputChannel->GetFrameSize() : 0);
+	}
+
+	Thread.Reset(Deltacast::Thread::Create(InputChannel.Get(), *FString::Printf(TEXT("Deltacast Media Player %s"), *GetMediaName().ToString()),
+	                                       GetDefault<UDeltacastMediaSettings>()->CaptureThread, static_cast<int32>(BoardIndex)));
 	if (Thread == nullptr)
 	{
 		UE_LOG(LogDeltacastMediaSource, Error, TEXT("Failed to start Deltacast input channel thread"));
@@ -231,6 +298,9 @@ void FDeltacastMediaPlayer::Close()
 	TextureSamplePool.Get()->Reset();
 	CurrentTextureSample.Reset();
 
+	// Samples still queued for rendering keep the arena alive until they are released
+	FrameArena.Reset();
+
 	Super::Close();
 }
 
@@ -271,6 +341,16 @@ void FDeltacastMediaPlayer::TickInput(FTimespan DeltaTime, FTimespan Timecode)
 		return;
 	}
 
+	const auto RequestedVideoFrameBufferCount = GetEngineBufferCount(ThreadBufferDepth);
+	if (RequestedVideoFrameBufferCount != VideoFrameBufferCount)
+	{
+		UE_LOG(LogDeltacastMediaSource, Display, TEXT("Changing the engine buffer count of input %s from %u to %u"),
+		       *GetUrl(), VideoFrameBufferCount, RequestedVideoFrameBufferCount);
+
+		VideoFrameBufferCount = RequestedVideoFrameBufferCount;
+		SetupSampleChannels();
+	}
+
 	TickTimeManagement();
 }
 
@@ -287,9 +367,29 @@ FString FDeltacastMediaPlayer::GetStats() const
 	Stats += FString::Printf(TEXT("\t\tFrames processed: %u\n"), ThreadFrameProcessedCount);
 	Stats += FString::Printf(TEXT("\t\tFrames dropped:   %u\n"), ThreadFrameDropCount);
 	Stats += FString::Printf(TEXT("\t\tBuffer fill:      %f\n"), ThreadBufferFill);
+	Stats += FString::Printf(TEXT("\t\tBuffer depth:     %u"), ThreadBufferDepth.load());
+	Stats += bAdaptiveBufferDepth ? FString::Printf(TEXT(" (adaptive, up to %u)\n"), MaxBufferDepth) : FString(TEXT("\n"));
 
 	Stats += TEXT("\nStatus Media Source\n");
 	Stats += FString::Printf(TEXT("\t\tBuffered video frames: %d\n"), GetSamples().NumVideoSamples());
+	Stats += FString::Printf(TEXT("\t\tEngine buffers:        %u\n"), VideoFrameBufferCount);
+
+	const auto PoolStats = TextureSamplePool->GetStats();
+
+	Stats += TEXT("\nSample pool\n");
+	Stats += FString::Printf(TEXT("\t\tSamples:     %d in use (peak %d), %d allocated, capacity %d\n"), PoolStats.InUse, PoolStats.PeakInUse, PoolStats.Allocated, PoolStats.Capacity);
+	Stats += FString::Printf(TEXT("\t\tAcquisitions: %llu hits, %llu misses, %llu rejected\n"), PoolStats.HitCount, PoolStats.MissCount, PoolStats.RejectedCount);
+
+	if (FrameArena.IsValid())
+	{
+		const auto ArenaStats = FrameArena->GetStats();
+
+		Stats += TEXT("\nFrame arena\n");
+		Stats += FString::Printf(TEXT("\t\tBlocks:      %u/%u x %.1f MB\n"), ArenaStats.BlocksInUse, ArenaStats.BlockCount, static_cast<double>(ArenaStats.BlockSize) / (1024.0 * 1024.0));
+		Stats += FString::Printf(TEXT("\t\tNUMA node:   %d, %s pages\n"), ArenaStats.NumaNode, ArenaStats.bUsesLargePages ? TEXT("large") : TEXT("regular"));
+		Stats += FString::Printf(TEXT("\t\tAllocations: %llu (%llu fallbacks)\n"), ArenaStats.AllocationCount, ArenaStats.FallbackCount);
+		Stats += FString::Printf(TEXT("\t\tPage faults: %llu\n"), ArenaStats.PageFaultCount);
+	}
 
 	return Stats;
 }
@@ -323,10 +423,15 @@ bool FDeltacastMediaPlayer::OnRequestInputBuffer(const FDeltacastRequestBuffer&
 		return false;
 	}
 
-	if (RequestBuffer.VideoBufferSize > 0 && RequestBuffer.bIsProgressive)
+	// Frames converted by the shader are copied to a buffer the converter can read
+	if (RequestBuffer.VideoBufferSize > 0 && RequestBuffer.bIsProgressive && !VideoColor.IsConvertedByShader())
 	{
-		CurrentTextureSample        = TextureSamplePool->AcquireShared();
-		RequestedBuffer.VideoBuffer = static_cast<uint8_t*>(CurrentTextureSample->RequestBuffer(RequestBuffer.VideoBufferSize));
+		CurrentTextureSample = TextureSamplePool->AcquireShared();
+		if (CurrentTextureSample.IsValid())
+		{
+			CurrentTextureSample->SetVideoColor(VideoColor);
+			RequestedBuffer.VideoBuffer = static_cast<uint8_t*>(CurrentTextureSample->RequestBuffer(FrameArena, RequestBuffer.VideoBufferSize));
+		}
 	}
 
 	return true;
@@ -375,6 +480,7 @@ bool FDeltacastMediaPlayer::OnInputFrameReceived(const FDeltacastVideoFrameData&
 
 	EMediaTextureSampleFormat VideoSampleFormat = EMediaTextureSampleFormat::CharBGRA;
 	EMediaIOCoreEncodePixelFormat EncodePixelFormat = EMediaIOCoreEncodePixelFormat::CharBGRA;
+	bool bCanEncodeTimecode = true;
 	FString OutputFilename;
 
 	switch (BufferPacking)
@@ -394,11 +500,22 @@ bool FDeltacastMediaPlayer::OnInputFrameReceived(const FDeltacastVideoFrameData&
 			EncodePixelFormat = EMediaIOCoreEncodePixelFormat::YUVv210;
 			OutputFilename = TEXT("Deltacast_Input_10_YUV");
 			break;
+		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGB_30:
+			VideoSampleFormat = EMediaTextureSampleFormat::CharBGR10A2;
+			EncodePixelFormat = EMediaIOCoreEncodePixelFormat::A2B10G10R10;
+			OutputFilename = TEXT("Deltacast_Input_10_RGB");
+			break;
+		case VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_RGBA_64:
+			// The timecode encoder has no 16-bit per component format
+			VideoSampleFormat = EMediaTextureSampleFormat::ABGR16;
+			bCanEncodeTimecode = false;
+			OutputFilename = TEXT("Deltacast_Input_10_RGBA");
+			break;
 		default:
 			break;
 	}
 
-	if (bEncodeTimecodeInTexel && DecodedTimecode.IsSet() && VideoFrame.bIsProgressive)
+	if (bEncodeTimecodeInTexel && bCanEncodeTimecode && DecodedTimecode.IsSet() && VideoFrame.bIsProgressive)
 	{
 		const FTimecode SetTimecode = DecodedTimecode.GetValue();
 		const FMediaIOCoreEncodeTime EncodeTime(EncodePixelFormat, VideoFrame.VideoBuffer, VideoFrame.Stride, VideoFrame.Width, VideoFrame.Height);
@@ -423,25 +540,48 @@ bool FDeltacastMediaPlayer::OnInputFrameReceived(const FDeltacastVideoFrameData&
 		if (VideoFrame.bIsProgressive)
 		{
 			const auto TextureSample = TextureSamplePool->AcquireShared();
-			if (TextureSample->InitializeProgressive(VideoFrame, VideoSampleFormat, DecodedTime, VideoFrameRate, DecodedTimecode, bIsSRGBInput))
+			if (TextureSample.IsValid())
 			{
-				Samples->AddVideo(TextureSample);
+				TextureSample->SetVideoColor(VideoColor);
+
+				if (TextureSample->InitializeProgressive(VideoFrame, VideoSampleFormat, DecodedTime, VideoFrameRate, DecodedTimecode, bIsSRGBInput, FrameArena))
+				{
+					Samples->AddVideo(TextureSample.ToSharedRef());
+				}
 			}
 		}
 		else
 		{
-			const auto bIsEven = GFrameCounterRenderThread % 2 == 1;
+			// Copied once, both field samples read the same buffer. One extra line keeps the half height bottom field reads in bounds.
+			const auto FrameBufferSize = VideoFrame.VideoBufferSize + VideoFrame.Stride;
+			const auto FrameBuffer     = FDeltacastFrameBuffer::Allocate(FrameArena, FrameBufferSize);
+			FMemory::Memcpy(FrameBuffer->GetData(), VideoFrame.VideoBuffer, VideoFrame.VideoBufferSize);
 
-			const auto TextureSampleFirstHalf = TextureSamplePool->AcquireShared();
-			if (TextureSampleFirstHalf->InitializeInterlaced_Half(VideoFrame, VideoSampleFormat, DecodedTime, VideoFrameRate, DecodedTimecode, bIsSRGBInput, bIsEven))
+			const auto bIsFirstFieldTop = VideoFrame.bIsTopFieldFirst;
+			const auto ShaderMode       = DeinterlaceModeToShaderMode(DeinterlaceMode);
+
+			// Deinterlaced on the GPU to full height frames at the field rate, or shown as half height fields
+			const auto InitializeField = [&](FDeltacastMediaTextureSample &TextureSample, const bool bIsTopField, const FTimespan &Time, const TOptional<FTimecode> &Timecode)
+			{
+				TextureSample.SetVideoColor(VideoColor);
+
+				return ShaderMode.has_value()
+					       ? TextureSample.InitializeDeinterlacedField(FrameBuffer, VideoFrame, bIsTopField, ShaderMode.value(), VideoSampleFormat, Time, VideoFrameRate, Timecode, bIsSRGBInput)
+					       : TextureSample.InitializeField(FrameBuffer, VideoFrame, bIsTopField, VideoSampleFormat, Time, VideoFrameRate, Timecode, bIsSRGBInput);
+			};
+
+			const auto TextureSampleFirstField = TextureSamplePool->AcquireShared();
+			if (TextureSampleFirstField.IsValid() &&
+			    InitializeField(*TextureSampleFirstField, bIsFirstFieldTop, DecodedTime, DecodedTimecode))
 			{
-				Samples->AddVideo(TextureSampleFirstHalf);
+				Samples->AddVideo(TextureSampleFirstField.ToSharedRef());
 			}
 
-			const auto TextureSampleSecondHalf = TextureSamplePool->AcquireShared();
-			if (TextureSampleSecondHalf->InitializeInterlaced_Half(VideoFrame, VideoSampleFormat, DecodedTimeF2, VideoFrameRate, DecodedTimecodeF2, bIsSRGBInput, !bIsEven))
+			const auto TextureSampleSecondField = TextureSamplePool->AcquireShared();
+			if (TextureSampleSecondField.IsValid() &&
+			    InitializeField(*TextureSampleSecondField, !bIsFirstFieldTop, DecodedTimeF2, DecodedTimecodeF2))
 			{
-				Samples->AddVideo(TextureSampleSecondHalf);
+				Samples->AddVideo(TextureSampleSecondField.ToSharedRef());
 			}
 		}
 	}
@@ -462,6 +602,11 @@ void FDeltacastMediaPlayer::OnSourceStopped()
 	ThreadMediaState = EMediaState::Stopped;
 }
 
+void FDeltacastMediaPlayer::OnBufferDepthChanged(const uint32 BufferDepth)
+{
+	ThreadBufferDepth = BufferDepth;
+}
+
 void FDeltacastMediaPlayer::OnCompletion(const bool bSucceed)
 {
 	ThreadMediaState = bSucceed ? EMediaState::Closed : EMediaState::Error;
@@ -476,7 +621,7 @@ bool FDeltacastMediaPlayer::IsHardwareReady() const
 void FDeltacastMediaPlayer::SetupSampleChannels()
 {
 	FMediaIOSamplingSettings VideoSettings = BaseSettings;
-	VideoSettings.BufferSize = MaxVideoFrameBufferCount;
+	VideoSettings.BufferSize = VideoFrameBufferCount;
 	Samples->InitializeVideoBuffer(VideoSettings);
 }
 
@@ -529,6 +674,13 @@ void FDeltacastMediaPlayer::VerifyFrameDropCount()
 	}
 }
 
+uint32 FDeltacastMediaPlayer::GetEngineBufferCount(const uint32 BufferDepth) const
+{
+	const auto Reduction = MaxBufferDepth > BufferDepth ? MaxBufferDepth - BufferDepth : 0;
+
+	return MaxVideoFrameBufferCount - FMath::Min(Reduction, MaxVideoFrameBufferCount - 1);
+}
+
 TSharedPtr<FMediaIOCoreTextureSampleBase> FDeltacastMediaPlayer::AcquireTextureSample_AnyThread() const
 {
 	return TextureSamplePool->AcquireShared();
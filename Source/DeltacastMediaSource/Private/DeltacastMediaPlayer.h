@@ -21,6 +21,8 @@
 #include "IMediaEventSink.h"
 #include "MediaIOCorePlayerBase.h"
 
+#include <atomic>
+
 
 class FDeltacastMediaPlayer : public FMediaIOCorePlayerBase,
                               public IDeltacastInputStreamCallback
@@ -50,6 +52,7 @@ public: //~ IDeltacastInputStreamCallback
 	virtual bool OnInputFrameReceived(const FDeltacastVideoFrameData& VideoFrame) override;
 	virtual void OnSourceResumed() override;
 	virtual void OnSourceStopped() override;
+	virtual void OnBufferDepthChanged(uint32 BufferDepth) override;
 	virtual void OnCompletion(bool bSucceed) override;
 
 protected: //~ FMediaIOCorePlayerBase
@@ -60,6 +63,9 @@ protected: //~ FMediaIOCorePlayerBase
 private:
 	void VerifyFrameDropCount();
 
+	/** Engine buffers for a Deltacast buffer depth, reduced by as many buffers as the depth is below its maximum */
+	[[nodiscard]] uint32 GetEngineBufferCount(uint32 BufferDepth) const;
+
 private:
 	using Super = FMediaIOCorePlayerBase;
 
@@ -74,6 +80,18 @@ private:
 
 	uint32 MaxVideoFrameBufferCount = 8;
 
+	bool   bAdaptiveBufferDepth = false;
+	uint32 MaxBufferDepth       = 8;
+
+	/** Engine buffers in use, follows the Deltacast buffer depth when it is adaptive */
+	uint32 VideoFrameBufferCount = 8;
+
+	std::atomic<uint32> ThreadBufferDepth = 8;
+
+	EDeltacastDeinterlaceMode DeinterlaceMode = EDeltacastDeinterlaceMode::Off;
+
+	FDeltacastVideoColor VideoColor;
+
 	VHD_BUFFERPACKING BufferPacking = VHD_BUFFERPACKING::VHD_BUFPACK_VIDEO_YUV422_8;
 
 private:
@@ -85,6 +103,9 @@ private:
 private:
 	TUniquePtr<FDeltacastMediaTextureSamplePool> TextureSamplePool;
 
+	/** Frame memory of the samples, sized for the engine buffers when the player is opened */
+	FDeltacastFrameArenaPtr FrameArena;
+
 	TSharedPtr<FDeltacastMediaTextureSample, ESPMode::ThreadSafe> CurrentTextureSample;
 
 private:
@@ -17,6 +17,7 @@
 
 #include "IDeltacastMediaSourceModule.h"
 #include "DeltacastDeviceScanner.h"
+#include "DeltacastBoardRegistry.h"
 #include "DeltacastMediaOption.h"
 #include "DeltacastSdk.h"
 #include "MediaIOCorePlayerBase.h"
@@ -25,7 +26,21 @@
 
 bool IsPixelFormatSupportedSdi(const EDeltacastMediaSourcePixelFormat PixelFormat)
 {
-	return PixelFormat != EDeltacastMediaSourcePixelFormat::PF_8BIT_RGBA;
+	return PixelFormat == EDeltacastMediaSourcePixelFormat::PF_8BIT_YUV422 ||
+	       PixelFormat == EDeltacastMediaSourcePixelFormat::PF_10BIT_YUV422;
+}
+
+bool IsPixelFormatSupportedByBoard(const EDeltacastMediaSourcePixelFormat PixelFormat, const FDeltacastBoardInfo& BoardInfo)
+{
+	switch (PixelFormat)
+	{
+	case EDeltacastMediaSourcePixelFormat::PF_10BIT_RGB:
+		return BoardInfo.bIsRgb10Supported;
+	case EDeltacastMediaSourcePixelFormat::PF_10BIT_RGBA:
+		return BoardInfo.bIsRgba10Supported;
+	default:
+		return true;
+	}
 }
 
 
@@ -75,6 +90,10 @@ bool UDeltacastMediaSource::GetMediaOption(const FName &Key, const bool DefaultV
 	{
 		return bLogDroppedFrameCount;
 	}
+	if (Key == DeltacastMediaOption::AdaptiveBufferDepth)
+	{
+		return bAdaptiveBufferDepth;
+	}
 
 	return Super::GetMediaOption(Key, DefaultValue);
 }
@@ -97,6 +116,10 @@ int64 UDeltacastMediaSource::GetMediaOption(const FName &Key, const int64 Defaul
 	{
 		return NumberOfEngineBuffers;
 	}
+	if (Key == DeltacastMediaOption::MinimumNumberOfDeltacastBuffers)
+	{
+		return FMath::Min(MinimumNumberOfDeltacastBuffers, NumberOfDeltacastBuffers);
+	}
 	if (Key == DeltacastMediaOption::PixelFormat)
 	{
 		return static_cast<int64>(PixelFormat);
@@ -121,6 +144,22 @@ int64 UDeltacastMediaSource::GetMediaOption(const FName &Key, const int64 Defaul
 	{
 		return static_cast<int64>(Deltacast::Helpers::GetDvVideoStandardFromDeviceModeIdentifier(MediaConfiguration.MediaMode.DeviceModeIdentifier));
 	}
+	if (Key == DeltacastMediaOption::DeinterlaceMode)
+	{
+		return static_cast<int64>(DeinterlaceMode);
+	}
+	if (Key == DeltacastMediaOption::Colorimetry)
+	{
+		return static_cast<int64>(Colorimetry);
+	}
+	if (Key == DeltacastMediaOption::TransferFunction)
+	{
+		return static_cast<int64>(TransferFunction);
+	}
+	if (Key == DeltacastMediaOption::HdrReferenceWhiteNits)
+	{
+		return HdrReferenceWhiteNits;
+	}
 
 	return Super::GetMediaOption(Key, DefaultValue);
 }
@@ -152,7 +191,13 @@ bool UDeltacastMediaSource::HasMediaOption(const FName &Key) const
 	    Key == DeltacastMediaOption::TimecodeFormat ||
 	    Key == DeltacastMediaOption::LogDroppedFrameCount ||
 		Key == DeltacastMediaOption::SdiVideoStandard ||
-		Key == DeltacastMediaOption::DvVideoStandard)
+		Key == DeltacastMediaOption::DvVideoStandard ||
+		Key == DeltacastMediaOption::DeinterlaceMode ||
+		Key == DeltacastMediaOption::Colorimetry ||
+		Key == DeltacastMediaOption::TransferFunction ||
+		Key == DeltacastMediaOption::HdrReferenceWhiteNits ||
+		Key == DeltacastMediaOption::AdaptiveBufferDepth ||
+		Key == DeltacastMediaOption::MinimumNumberOfDeltacastBuffers)
 	{
 		return true;
 	}
@@ -176,6 +221,14 @@ bool UDeltacastMediaSource::Validate() const
 		return false;
 	}
 
+	// The half height field samples go through the engine conversion, which has neither the transfer functions nor the primaries conversion
+	const auto bIsColorConverted = TransferFunction != EDeltacastTransferFunction::SDR || Colorimetry == EDeltacastColorimetry::Rec2020;
+	if (bIsColorConverted && DeinterlaceMode == EDeltacastDeinterlaceMode::Off && MediaConfiguration.MediaMode.Standard != EMediaIOStandardType::Progressive)
+	{
+		UE_LOG(LogDeltacastMediaSource, Warning, TEXT("The transfer function and colorimetry of '%s' need a deinterlace mode on interlaced inputs."), *GetName());
+		return false;
+	}
+
 	const auto bIsSdi = Deltacast::Helpers::IsDeviceModeIdentifierSdi(MediaConfiguration.MediaMode.DeviceModeIdentifier);
 	const auto bIsDv  = Deltacast::Helpers::IsDeviceModeIdentifierDv(MediaConfiguration.MediaMode.DeviceModeIdentifier);
 
@@ -209,20 +262,14 @@ bool UDeltacastMediaSource::Validate() const
 			                           ? Deltacast::Helpers::GetSingleLinkInterface(VideoStandard, false)
 			                           : Deltacast::Helpers::GetQuadLinkInterface(VideoStandard, QuadLinkType, false);
 
-		auto &DeltacastSdk = FDeltacast::GetSdk();
-
-		const auto BoardHandle = DeltacastSdk.OpenBoard(PortConfig.Base.BoardIndex).value_or(VHD::InvalidHandle);
-		if (!BoardHandle)
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(PortConfig.Base.BoardIndex);
+		if (!Board.IsValid())
 		{
 			UE_LOG(LogDeltacastMediaSource, Error, TEXT("Failed to validate Deltacast media source because board handle cannot be obtained"));
 			return false;
 		}
 
-		const auto bIsValid = PortConfig.IsValid(BoardHandle);
-
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
-
-		return bIsValid;
+		return PortConfig.IsValid(*Board);
 	}
 
 	if (bIsDv)
@@ -236,20 +283,20 @@ bool UDeltacastMediaSource::Validate() const
 
 		PortConfig.VideoStandard = Deltacast::Helpers::GetDvVideoStandardFromDeviceModeIdentifier(MediaConfiguration.MediaMode.DeviceModeIdentifier);
 
-		auto& DeltacastSdk = FDeltacast::GetSdk();
-
-		const auto BoardHandle = DeltacastSdk.OpenBoard(PortConfig.Base.BoardIndex).value_or(VHD::InvalidHandle);
-		if (!BoardHandle)
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(PortConfig.Base.BoardIndex);
+		if (!Board.IsValid())
 		{
 			UE_LOG(LogDeltacastMediaSource, Error, TEXT("Failed to validate Deltacast media source because board handle cannot be obtained"));
 			return false;
 		}
 
-		const auto bIsValid = PortConfig.IsValid(BoardHandle);
-
-		DeltacastSdk.CloseBoardHandle(BoardHandle);
+		if (!IsPixelFormatSupportedByBoard(PixelFormat, Board->GetInfo()))
+		{
+			UE_LOG(LogDeltacastMediaSource, Warning, TEXT("The board of '%s' does not support its pixel format."), *GetName());
+			return false;
+		}
 
-		return bIsValid;
+		return PortConfig.IsValid(*Board);
 	}
 
 	return false;
@@ -292,11 +339,11 @@ void UDeltacastMediaSource::PostEditChangeChainProperty(struct FPropertyChangedC
 
 		auto& DeltacastSdk = FDeltacast::GetSdk();
 
-		const auto BoardHandle = DeltacastSdk.OpenBoard(DeviceIndex);
+		const auto Board = FDeltacast::GetBoardRegistry().Acquire(DeviceIndex);
 
-		if (BoardHandle.has_value())
+		if (Board.IsValid())
 		{
-			const auto ChannelType = DeltacastSdk.GetChannelType(BoardHandle.value(), false, PortIndex);
+			const auto ChannelType = DeltacastSdk.GetChannelType(Board->GetHandle(), false, PortIndex);
 
 			const auto IsSdi = Deltacast::Helpers::IsSdi(ChannelType.value_or(VHD_CHANNELTYPE::NB_VHD_CHANNELTYPE));
 
@@ -305,7 +352,10 @@ void UDeltacastMediaSource::PostEditChangeChainProperty(struct FPropertyChangedC
 				PixelFormat = DefaultPixelFormatSdi;
 			}
 
-			DeltacastSdk.CloseBoardHandle(BoardHandle.value());
+			if (!IsPixelFormatSupportedByBoard(PixelFormat, Board->GetInfo()))
+			{
+				PixelFormat = DefaultPixelFormatDv;
+			}
 		}
 	}
 
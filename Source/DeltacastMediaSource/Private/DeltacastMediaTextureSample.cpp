@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) DELTACAST.TV. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at * * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DeltacastMediaTextureSample.h"
+
+#include "Misc/ScopeLock.h"
+
+
+
+FDeltacastMediaTextureSamplePool::FDeltacastMediaTextureSamplePool()
+	: Storage(MakeShared<FStorage, ESPMode::ThreadSafe>()) { }
+
+FDeltacastMediaTextureSamplePool::~FDeltacastMediaTextureSamplePool()
+{
+	Reset();
+}
+
+
+void FDeltacastMediaTextureSamplePool::Prewarm(const int32 SampleCount, const int32 Capacity, const uint32 BufferSize)
+{
+	FScopeLock Lock(&Storage->CriticalSection);
+
+	Storage->bIsOpen = true;
+
+	auto& Stats = Storage->Stats;
+	Stats.Capacity      = FMath::Max(Capacity, SampleCount);
+	Stats.PeakInUse     = Stats.InUse;
+	Stats.HitCount      = 0;
+	Stats.MissCount     = 0;
+	Stats.RejectedCount = 0;
+
+	while (Stats.Allocated < SampleCount)
+	{
+		const auto Sample = new FDeltacastMediaTextureSample();
+
+		if (BufferSize > 0)
+		{
+			Sample->CommitBuffer(BufferSize);
+		}
+
+		Storage->Samples.Add(Sample);
+		++Stats.Allocated;
+	}
+}
+
+FDeltacastMediaTextureSamplePool::FSampleRef FDeltacastMediaTextureSamplePool::AcquireShared()
+{
+	FDeltacastMediaTextureSample* Sample = nullptr;
+
+	{
+		FScopeLock Lock(&Storage->CriticalSection);
+
+		auto& Stats = Storage->Stats;
+
+		if (!Storage->Samples.IsEmpty())
+		{
+			Sample = Storage->Samples.Pop(EAllowShrinking::No);
+			++Stats.HitCount;
+		}
+		else if (Stats.Capacity > 0 && Stats.Allocated >= Stats.Capacity)
+		{
+			++Stats.RejectedCount;
+			return nullptr;
+		}
+		else
+		{
+			Sample = new FDeltacastMediaTextureSample();
+			++Stats.Allocated;
+			++Stats.MissCount;
+		}
+
+		++Stats.InUse;
+		Stats.PeakInUse = FMath::Max(Stats.PeakInUse, Stats.InUse);
+	}
+
+	Sample->InitializePoolable();
+
+	return MakeShareable(Sample, [Storage = Storage](FDeltacastMediaTextureSample* ReleasedSample)
+	{
+		ReleasedSample->ShutdownPoolable();
+
+		FScopeLock Lock(&Storage->CriticalSection);
+
+		--Storage->Stats.InUse;
+
+		if (Storage->bIsOpen)
+		{
+			Storage->Samples.Add(ReleasedSample);
+		}
+		else
+		{
+			--Storage->Stats.Allocated;
+			delete ReleasedSample;
+		}
+	});
+}
+
+void FDeltacastMediaTextureSamplePool::Reset()
+{
+	TArray<FDeltacastMediaTextureSample*> Samples;
+
+	{
+		FScopeLock Lock(&Storage->CriticalSection);
+
+		Storage->bIsOpen = false;
+		Storage->Stats.Allocated -= Storage->Samples.Num();
+
+		Samples = MoveTemp(Storage->Samples);
+	}
+
+	for (const auto Sample : Samples)
+	{
+		delete Sample;
+	}
+}
+
+FDeltacastMediaTextureSamplePool::FStats FDeltacastMediaTextureSamplePool::GetStats() const
+{
+	FScopeLock Lock(&Storage->CriticalSection);
+
+	return Storage->Stats;
+}
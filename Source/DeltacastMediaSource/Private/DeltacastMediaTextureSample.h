@@ -15,6 +15,9 @@
 
 #pragma once
 
+#include "DeltacastDeinterlacer.h"
+#include "DeltacastFrameArena.h"
+#include "DeltacastMediaColor.h"
 #include "MediaIOCoreTextureSampleBase.h"
 #include "MediaShaders.h"
 
@@ -39,23 +42,88 @@ struct FDeltacastVideoFrameData
 
 	bool bIsProgressive;
 
+	/** Interlaced only, the field on the first line is the first one in time */
+	bool bIsTopFieldFirst;
+
+	/** Interlaced only, the buffer holds the bottom field then the top field instead of woven lines */
+	bool bIsFieldSeparated;
+
 	FDeltacastVideoFrameMetaData MetaData;
 };
 
+/** Colorimetry and transfer function of the input signal */
+struct FDeltacastVideoColor
+{
+	EDeltacastColorimetry      Colorimetry        = EDeltacastColorimetry::Auto;
+	EDeltacastTransferFunction TransferFunction   = EDeltacastTransferFunction::SDR;
+	int32                      ReferenceWhiteNits = 100;
+
+	/** The engine converter has neither the Rec. 2020 primaries nor the HDR transfer functions */
+	[[nodiscard]] bool IsConvertedByShader() const
+	{
+		return TransferFunction != EDeltacastTransferFunction::SDR || Colorimetry == EDeltacastColorimetry::Rec2020;
+	}
+};
+
 
 class FDeltacastMediaTextureSample : public FMediaIOCoreTextureSampleBase
 {
 	using Super = FMediaIOCoreTextureSampleBase;
 
 public:
+	/** Frame memory from the arena when it has a free block, from the sample own buffer otherwise */
+	void* RequestBuffer(const FDeltacastFrameArenaPtr &Arena, const uint32 BufferSize)
+	{
+		SetFrameBuffer(FDeltacastFrameBuffer::FromArena(Arena, BufferSize), 0);
+		if (FrameBuffer.IsValid())
+		{
+			return FrameBuffer->GetData();
+		}
+
+		return Super::RequestBuffer(BufferSize);
+	}
+
+	/** Colorimetry of the frames the sample is initialized with */
+	void SetVideoColor(const FDeltacastVideoColor &InVideoColor)
+	{
+		VideoColor = InVideoColor;
+	}
+
+	/** Allocates and touches the sample own buffer so that the first capture into it does not page fault */
+	void CommitBuffer(const uint32 BufferSize)
+	{
+		FMemory::Memzero(Super::RequestBuffer(BufferSize), BufferSize);
+	}
+
 	bool InitializeProgressive(const FDeltacastVideoFrameData &VideoData,
 	                           const EMediaTextureSampleFormat TextureSampleFormat,
 	                           const FTimespan                 Timespan,
 	                           const FFrameRate &              FrameRate,
 	                           const TOptional<FTimecode> &    OptionalTimecode,
-	                           const bool                      bInIsSRGB)
+	                           const bool                      bInIsSRGB,
+	                           const FDeltacastFrameArenaPtr & Arena)
 	{
 		bIsSd = IsSd(VideoData);
+
+		if (VideoColor.IsConvertedByShader())
+		{
+			// Converted on the GPU, the frame is read as its two woven fields
+			const auto ConvertedFrameBuffer = FDeltacastFrameBuffer::Allocate(Arena, VideoData.VideoBufferSize);
+			FMemory::Memcpy(ConvertedFrameBuffer->GetData(), VideoData.VideoBuffer, VideoData.VideoBufferSize);
+
+			SetFrameBuffer(ConvertedFrameBuffer, 0);
+			Deinterlacer.Setup(ConvertedFrameBuffer, GetConversionDesc(VideoData, { 0, 1, 2 }, true, FDeltacastDeinterlaceCS::EMode::Weave, TextureSampleFormat, bInIsSRGB));
+
+			return SetProperties(VideoData.Stride, VideoData.Width, VideoData.Height, TextureSampleFormat, Timespan, FrameRate, OptionalTimecode, bInIsSRGB);
+		}
+
+		SetFrameBuffer(FDeltacastFrameBuffer::FromArena(Arena, VideoData.VideoBufferSize), 0);
+		if (FrameBuffer.IsValid())
+		{
+			FMemory::Memcpy(FrameBuffer->GetData(), VideoData.VideoBuffer, VideoData.VideoBufferSize);
+			return SetProperties(VideoData.Stride, VideoData.Width, VideoData.Height, TextureSampleFormat, Timespan, FrameRate, OptionalTimecode, bInIsSRGB);
+		}
+
 		return Super::Initialize(VideoData.VideoBuffer,
 		                         VideoData.VideoBufferSize,
 		                         VideoData.Stride,
@@ -68,34 +136,158 @@ public:
 		                         bInIsSRGB);
 	}
 
-	bool InitializeInterlaced_Half(const FDeltacastVideoFrameData &VideoData,
-	                               const EMediaTextureSampleFormat TextureSampleFormat,
-	                               const FTimespan                 Timespan,
-	                               const FFrameRate &              FrameRate,
-	                               const TOptional<FTimecode> &    OptionalTimecode,
-	                               const bool                      bIsSRGB,
-	                               const bool                      bIsEven)
+	/**
+	 * One half height field of an interlaced frame, read in place from the frame buffer shared with the sample of the other field.
+	 */
+	bool InitializeField(const FDeltacastFrameBufferPtr & InFrameBuffer,
+	                     const FDeltacastVideoFrameData & VideoData,
+	                     const bool                       bIsTopField,
+	                     const EMediaTextureSampleFormat  TextureSampleFormat,
+	                     const FTimespan                  Timespan,
+	                     const FFrameRate &               FrameRate,
+	                     const TOptional<FTimecode> &     OptionalTimecode,
+	                     const bool                       bIsSRGB)
 	{
 		bIsSd = IsSd(VideoData);
-		return Super::InitializeWithEvenOddLine(bIsEven,
-		                                        VideoData.VideoBuffer,
-		                                        VideoData.VideoBufferSize,
-		                                        VideoData.Stride,
-		                                        VideoData.Width,
-		                                        VideoData.Height,
-		                                        TextureSampleFormat,
-		                                        Timespan,
-		                                        FrameRate,
-		                                        OptionalTimecode,
-		                                        bIsSRGB);
+
+		const auto Layout   = GetFieldLayout(VideoData);
+		const auto FirstRow = bIsTopField ? Layout.TopFieldFirstRow : Layout.BottomFieldFirstRow;
+
+		SetFrameBuffer(InFrameBuffer, FirstRow * VideoData.Stride);
+
+		return SetProperties(VideoData.Stride * Layout.FieldRowStep, VideoData.Width, VideoData.Height / 2, TextureSampleFormat, Timespan, FrameRate, OptionalTimecode, bIsSRGB);
+	}
+
+	/**
+	 * One field of an interlaced frame deinterlaced on the GPU to a full height texture when the sample is converted.
+	 * The frame buffer is shared with the sample of the other field.
+	 */
+	bool InitializeDeinterlacedField(const FDeltacastFrameBufferPtr &     InFrameBuffer,
+	                                 const FDeltacastVideoFrameData &     VideoData,
+	                                 const bool                           bIsTopField,
+	                                 const FDeltacastDeinterlaceCS::EMode Mode,
+	                                 const EMediaTextureSampleFormat      TextureSampleFormat,
+	                                 const FTimespan                      Timespan,
+	                                 const FFrameRate &                   FrameRate,
+	                                 const TOptional<FTimecode> &         OptionalTimecode,
+	                                 const bool                           bIsSRGB)
+	{
+		bIsSd = IsSd(VideoData);
+
+		SetFrameBuffer(InFrameBuffer, 0);
+		Deinterlacer.Setup(InFrameBuffer, GetConversionDesc(VideoData, GetFieldLayout(VideoData), bIsTopField, Mode, TextureSampleFormat, bIsSRGB));
+
+		// The texture is written by the deinterlacer, the buffer properties only describe its size
+		return SetProperties(VideoData.Stride, VideoData.Width, VideoData.Height, TextureSampleFormat, Timespan, FrameRate, OptionalTimecode, bIsSRGB);
 	}
 
 	virtual const FMatrix& GetYUVToRGBMatrix() const override
 	{
-		return bIsSd ? MediaShaders::YuvToRgbRec601Scaled : MediaShaders::YuvToRgbRec709Scaled;
+		switch (VideoColor.Colorimetry)
+		{
+			case EDeltacastColorimetry::Rec601:
+				return MediaShaders::YuvToRgbRec601Scaled;
+			case EDeltacastColorimetry::Rec709:
+				return MediaShaders::YuvToRgbRec709Scaled;
+			case EDeltacastColorimetry::Rec2020:
+				return DeltacastMediaShaders::YuvToRgbRec2020Scaled;
+			case EDeltacastColorimetry::Auto: [[fallthrough]];
+			default:
+				return bIsSd ? MediaShaders::YuvToRgbRec601Scaled : MediaShaders::YuvToRgbRec709Scaled;
+		}
+	}
+
+	virtual IMediaTextureSampleConverter* GetMediaTextureSampleConverter() override
+	{
+		return Deinterlacer.IsSet() ? &Deinterlacer : Super::GetMediaTextureSampleConverter();
+	}
+
+	virtual const void* GetBuffer() override
+	{
+		return FrameBuffer.IsValid() ? FrameBuffer->GetData() + FrameBufferOffset : Super::GetBuffer();
+	}
+
+	virtual void ShutdownPoolable() override
+	{
+		SetFrameBuffer(nullptr, 0);
+		Deinterlacer.Reset();
+		Super::ShutdownPoolable();
+	}
+
+private:
+	void SetFrameBuffer(const FDeltacastFrameBufferPtr &InFrameBuffer, const uint32 Offset)
+	{
+		FrameBuffer       = InFrameBuffer;
+		FrameBufferOffset = Offset;
 	}
 
 private:
+	struct FFieldLayout
+	{
+		/** Buffer row of the first line of each field */
+		uint32 TopFieldFirstRow;
+		uint32 BottomFieldFirstRow;
+
+		/** Buffer rows between two lines of a field */
+		uint32 FieldRowStep;
+	};
+
+	static FFieldLayout GetFieldLayout(const FDeltacastVideoFrameData& VideoData)
+	{
+		if (VideoData.bIsFieldSeparated)
+		{
+			// The first half of the buffer holds the bottom field
+			return { VideoData.Height / 2, 0, 1 };
+		}
+
+		return { 0, 1, 2 };
+	}
+
+	FDeltacastDeinterlaceCS::FDesc GetConversionDesc(const FDeltacastVideoFrameData &     VideoData,
+	                                                 const FFieldLayout &                 Layout,
+	                                                 const bool                           bIsTopField,
+	                                                 const FDeltacastDeinterlaceCS::EMode Mode,
+	                                                 const EMediaTextureSampleFormat      TextureSampleFormat,
+	                                                 const bool                           bIsSRGB) const
+	{
+		FDeltacastDeinterlaceCS::FDesc Desc;
+		Desc.FrameSize           = FUintVector2(VideoData.Width, VideoData.Height);
+		Desc.Stride              = VideoData.Stride;
+		Desc.TopFieldFirstRow    = Layout.TopFieldFirstRow;
+		Desc.BottomFieldFirstRow = Layout.BottomFieldFirstRow;
+		Desc.FieldRowStep        = Layout.FieldRowStep;
+		Desc.bIsTopField         = bIsTopField;
+		Desc.Mode                = Mode;
+		Desc.Format              = GetDeinterlaceFormat(TextureSampleFormat);
+		Desc.YuvToRgb            = GetYUVToRGBMatrix();
+		Desc.YuvOffset           = Desc.Format == FDeltacastDeinterlaceCS::EFormat::V210 ? MediaShaders::YUVOffset10bits : MediaShaders::YUVOffset8bits;
+
+		Desc.ColorConversion = FDeltacastColorConversion::Make(VideoColor.TransferFunction, VideoColor.ReferenceWhiteNits, bIsSRGB);
+		if (VideoColor.Colorimetry == EDeltacastColorimetry::Rec2020)
+		{
+			Desc.ColorConversion.Gamut = DeltacastMediaShaders::Rec2020ToRec709;
+		}
+
+		return Desc;
+	}
+
+	static FDeltacastDeinterlaceCS::EFormat GetDeinterlaceFormat(const EMediaTextureSampleFormat TextureSampleFormat)
+	{
+		switch (TextureSampleFormat)
+		{
+			case EMediaTextureSampleFormat::CharUYVY:
+				return FDeltacastDeinterlaceCS::EFormat::UYVY8;
+			case EMediaTextureSampleFormat::YUVv210:
+				return FDeltacastDeinterlaceCS::EFormat::V210;
+			case EMediaTextureSampleFormat::CharBGR10A2:
+				return FDeltacastDeinterlaceCS::EFormat::RGB10;
+			case EMediaTextureSampleFormat::ABGR16:
+				return FDeltacastDeinterlaceCS::EFormat::RGBA16;
+			default:
+				return FDeltacastDeinterlaceCS::EFormat::BGRA8;
+		}
+	}
+
 	static bool IsSd(const FDeltacastVideoFrameData& VideoData)
 	{
 		return (VideoData.Width == 720 && (VideoData.Height == 480 || VideoData.Height == 576)) ||
@@ -104,6 +296,79 @@ private:
 
 private:
 	bool bIsSd = false;
+
+	FDeltacastVideoColor VideoColor;
+
+	/** Frame memory outside of the sample own buffer, shared by the two fields of an interlaced frame */
+	FDeltacastFrameBufferPtr FrameBuffer;
+	uint32                   FrameBufferOffset = 0;
+
+	/** Set for the field samples deinterlaced on the GPU */
+	FDeltacastDeinterlacer Deinterlacer;
 };
 
-class FDeltacastMediaTextureSamplePool : public TMediaObjectPool<FDeltacastMediaTextureSample> { };
+/**
+ * Sample pool filled when the player is opened and bounded, acquiring past the capacity fails instead of allocating
+ */
+class FDeltacastMediaTextureSamplePool final
+{
+public:
+	using FSampleRef = TSharedPtr<FDeltacastMediaTextureSample, ESPMode::ThreadSafe>;
+
+	struct FStats
+	{
+		int32 Capacity  = 0;
+		int32 Allocated = 0;
+		int32 InUse     = 0;
+		int32 PeakInUse = 0;
+
+		/** Acquisitions served by a pooled sample */
+		uint64 HitCount = 0;
+
+		/** Acquisitions that allocated a new sample */
+		uint64 MissCount = 0;
+
+		/** Acquisitions refused because the capacity was reached */
+		uint64 RejectedCount = 0;
+	};
+
+public:
+	FDeltacastMediaTextureSamplePool();
+	~FDeltacastMediaTextureSamplePool();
+
+	FDeltacastMediaTextureSamplePool(const FDeltacastMediaTextureSamplePool &Other)     = delete;
+	FDeltacastMediaTextureSamplePool(FDeltacastMediaTextureSamplePool &&Other) noexcept = delete;
+
+	FDeltacastMediaTextureSamplePool &operator=(const FDeltacastMediaTextureSamplePool &Other)     = delete;
+	FDeltacastMediaTextureSamplePool &operator=(FDeltacastMediaTextureSamplePool &&Other) noexcept = delete;
+
+public:
+	/**
+	 * Allocates the samples up front and resets the statistics.
+	 * A non-zero buffer size commits the sample own buffers, for when the frames are not served by an arena.
+	 */
+	void Prewarm(int32 SampleCount, int32 Capacity, uint32 BufferSize);
+
+	/** nullptr when all the samples allowed by the capacity are in use */
+	[[nodiscard]] FSampleRef AcquireShared();
+
+	/** Deletes the pooled samples, samples in use are deleted when released */
+	void Reset();
+
+	[[nodiscard]] FStats GetStats() const;
+
+private:
+	struct FStorage
+	{
+		FCriticalSection CriticalSection;
+
+		TArray<FDeltacastMediaTextureSample*> Samples;
+
+		/** Samples in use are not pooled back once the pool is reset or destroyed */
+		bool bIsOpen = true;
+
+		FStats Stats;
+	};
+
+	TSharedRef<FStorage, ESPMode::ThreadSafe> Storage;
+};
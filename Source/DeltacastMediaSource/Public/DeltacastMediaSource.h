@@ -15,6 +15,7 @@
 
 #pragma once
 
+#include "DeltacastMediaColor.h"
 #include "MediaIOCoreDefinitions.h"
 #include "TimeSynchronizableMediaSource.h"
 
@@ -30,6 +31,27 @@ enum class EDeltacastMediaSourcePixelFormat : uint8
 	PF_8BIT_RGBA UMETA(DisplayName = "8bit RGBA"),
 	PF_8BIT_YUV422 UMETA(DisplayName = "8bit YUV"),
 	PF_10BIT_YUV422 UMETA(DisplayName = "10bit YUV"),
+	PF_10BIT_RGB UMETA(DisplayName = "10bit RGB"),
+	PF_10BIT_RGBA UMETA(DisplayName = "10bit RGBA"),
+};
+
+/**
+ * How the fields of an interlaced input are turned into textures.
+ */
+UENUM()
+enum class EDeltacastDeinterlaceMode : uint8
+{
+	/** Each field is a half height sample */
+	Off UMETA(DisplayName = "Field Samples"),
+	/** Missing lines are interpolated from the lines of the field */
+	Bob,
+	/** Missing lines are taken from the other field of the frame */
+	Weave,
+	/**
+	 * Weave where the other field matches the interpolation of the field, bob where it differs.
+	 * Only the current frame is compared, fine vertical detail is softened like motion.
+	 */
+	IntraFrameAdaptive UMETA(DisplayName = "Adaptive (intra-frame)"),
 };
 
 
@@ -64,20 +86,57 @@ public:
 	 * A sRGB to Linear conversion will be applied resulting in a texture in linear space.
 	 * @Note If the texture is not in linear space, it won't look correct in the editor. Another pass will be required either through Composure or other means.
 	 */
-	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Video", meta = (EditCondition = "PixelFormat == EDeltacastMediaSourcePixelFormat::PF_8BIT_RGBA", EditConditionHides))
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Video", meta = (EditCondition = "PixelFormat == EDeltacastMediaSourcePixelFormat::PF_8BIT_RGBA || PixelFormat == EDeltacastMediaSourcePixelFormat::PF_10BIT_RGB || PixelFormat == EDeltacastMediaSourcePixelFormat::PF_10BIT_RGBA", EditConditionHides))
 	bool bIsSRGBInput = false;
 
+	/**
+	 * Primaries and YUV matrix of the signal.
+	 * With Rec. 2020, the frames decoded to linear are converted to the Rec. 709 primaries of the engine.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Video")
+	EDeltacastColorimetry Colorimetry = EDeltacastColorimetry::Auto;
+
+	/**
+	 * Transfer function of the signal, decoded to a linear texture on the GPU along with the YUV conversion.
+	 * Interlaced inputs need a deinterlace mode with PQ, HLG or Rec. 2020, the half height field samples are not converted.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Video")
+	EDeltacastTransferFunction TransferFunction = EDeltacastTransferFunction::SDR;
+
+	/** Luminance given the linear value 1.0, in nits, HLG is referred to a 1000 nits peak. */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Video", meta = (ClampMin = "1", ClampMax = "10000", EditCondition = "TransferFunction != EDeltacastTransferFunction::SDR"))
+	int32 HdrReferenceWhiteNits = 100;
+
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Video")
 	bool bErrorOnSourceLost = true;
 
+	/**
+	 * Deinterlacing of interlaced inputs, done on the GPU.
+	 * Each field gives a full height progressive texture, at the field rate, unless left to the field samples.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Video")
+	EDeltacastDeinterlaceMode DeinterlaceMode = EDeltacastDeinterlaceMode::Off;
+
 	/**
 	 * Number of frame used by the Deltacast SDK.
 	 * A smaller number is most likely to cause missed frame.
 	 * A bigger number is most likely to increase latency.
+	 * Upper bound of the depth when the buffer depth is adaptive.
 	 */
 	UPROPERTY(BlueprintReadOnly, EditAnywhere, AdvancedDisplay, Category = "Video", meta = (ClampMin = "2", ClampMax = "32"))
 	int32 NumberOfDeltacastBuffers = 4;
 
+	/**
+	 * Start with the minimum number of Deltacast buffers and adjust it from the dropped frames and the buffer fill.
+	 * Each adjustment restarts the stream and is logged.
+	 */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, AdvancedDisplay, Category = "Video")
+	bool bAdaptiveBufferDepth = false;
+
+	/** Lower bound of the depth when the buffer depth is adaptive. */
+	UPROPERTY(BlueprintReadOnly, EditAnywhere, AdvancedDisplay, Category = "Video", meta = (ClampMin = "2", ClampMax = "32", EditCondition = "bAdaptiveBufferDepth"))
+	int32 MinimumNumberOfDeltacastBuffers = 2;
+
 	/**
 	 * Number of frame used by Unreal Engine.
 	 * A smaller number is most likely to cause missed frame.